@@ -0,0 +1,212 @@
+#ifndef DPP_ATOMIC_HPP
+# define DPP_ATOMIC_HPP
+# pragma once
+
+#include <atomic>
+
+#include "dpp.hpp"
+
+namespace dpp::detail
+{
+
+// the significand and exponent are packed into a padding-free integer, so
+// that compare-exchange compares values, not padding
+template <std::size_t N>
+using atomic_rep_t = std::conditional_t<
+    N <= 32,
+    std::uint32_t,
+    std::conditional_t<
+      N <= 64,
+      std::uint64_t,
+#if defined(__SIZEOF_INT128__)
+      std::conditional_t<N <= 128, unsigned __int128, void>
+#else
+      void
+#endif // __SIZEOF_INT128__
+    >
+  >;
+
+template <typename T, typename E>
+concept atomic_packable = std::integral<T> && std::integral<E> &&
+  !std::is_void_v<atomic_rep_t<ar::bit_size_v<T> + ar::bit_size_v<E>>>;
+
+constexpr auto atomic_load_order(std::memory_order const o) noexcept
+{
+  switch (o)
+  {
+    case std::memory_order_release: return std::memory_order_relaxed;
+    case std::memory_order_acq_rel: return std::memory_order_acquire;
+    default: return o;
+  }
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+namespace std
+{
+
+// 16 byte representations (d64) need cmpxchg16b, build with -mcx16 and link
+// with -latomic
+template <typename T, typename E, dpp::rounding R>
+  requires(dpp::detail::atomic_packable<T, E>)
+struct atomic<dpp::dpp<T, E, R>>
+{
+  using value_type = dpp::dpp<T, E, R>;
+  using difference_type = value_type;
+
+private:
+  using U = make_unsigned_t<T>;
+  using V = make_unsigned_t<E>;
+
+  using rep_t = dpp::detail::atomic_rep_t<ar::bit_size_v<T> +
+    ar::bit_size_v<E>>;
+
+  std::atomic<rep_t> a_;
+
+  static constexpr rep_t pack(value_type const& a) noexcept
+  { // nans share a representation
+    return (dpp::isnan(a) ? rep_t{} : rep_t(U(a.sig()))) |
+      rep_t(V(a.exp())) << ar::bit_size_v<T>;
+  }
+
+  static constexpr value_type unpack(rep_t const r) noexcept
+  {
+    return {dpp::direct, T(U(r)), E(V(r >> ar::bit_size_v<T>))};
+  }
+
+public:
+  static constexpr bool is_always_lock_free{
+    std::atomic<rep_t>::is_always_lock_free};
+
+  constexpr atomic() noexcept: atomic(value_type{dpp::direct, T{}}) { }
+  constexpr atomic(value_type const& a) noexcept: a_(pack(a)) { }
+
+  atomic(atomic const&) = delete;
+  atomic& operator=(atomic const&) = delete;
+  atomic& operator=(atomic const&) volatile = delete;
+
+  //
+  value_type operator=(value_type const& a) noexcept { return store(a), a; }
+  operator value_type() const noexcept { return load(); }
+
+  value_type operator+=(value_type const& a) noexcept
+  {
+    return fetch_add(a) + a;
+  }
+
+  value_type operator-=(value_type const& a) noexcept
+  {
+    return fetch_sub(a) - a;
+  }
+
+  //
+  bool is_lock_free() const noexcept { return a_.is_lock_free(); }
+
+  void store(value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  {
+    a_.store(pack(a), o);
+  }
+
+  value_type load(memory_order const o = memory_order_seq_cst) const noexcept
+  {
+    return unpack(a_.load(o));
+  }
+
+  value_type exchange(value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  {
+    return unpack(a_.exchange(pack(a), o));
+  }
+
+  bool compare_exchange_weak(value_type& e, value_type const& a,
+    memory_order const s, memory_order const f) noexcept
+  { // compares representations, 1.5 and 1.50 differ
+    auto r(pack(e));
+
+    return a_.compare_exchange_weak(r, pack(a), s, f) ||
+      (e = unpack(r), false);
+  }
+
+  bool compare_exchange_weak(value_type& e, value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  {
+    return compare_exchange_weak(e, a, o, dpp::detail::atomic_load_order(o));
+  }
+
+  bool compare_exchange_strong(value_type& e, value_type const& a,
+    memory_order const s, memory_order const f) noexcept
+  {
+    auto r(pack(e));
+
+    return a_.compare_exchange_strong(r, pack(a), s, f) ||
+      (e = unpack(r), false);
+  }
+
+  bool compare_exchange_strong(value_type& e, value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  {
+    return compare_exchange_strong(e, a, o,
+      dpp::detail::atomic_load_order(o));
+  }
+
+  // read-modify-write, CAS loops over the dpp operators
+  value_type fetch_add(value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  {
+    auto r(a_.load(memory_order_relaxed));
+
+    while (!a_.compare_exchange_weak(r, pack(unpack(r) + a), o,
+      memory_order_relaxed));
+
+    return unpack(r);
+  }
+
+  value_type fetch_sub(value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  {
+    auto r(a_.load(memory_order_relaxed));
+
+    while (!a_.compare_exchange_weak(r, pack(unpack(r) - a), o,
+      memory_order_relaxed));
+
+    return unpack(r);
+  }
+
+  value_type fetch_min(value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  { // no store, if a is not less than the current value (or either is nan)
+    auto r(a_.load(dpp::detail::atomic_load_order(o)));
+
+    while ((a < unpack(r)) && !a_.compare_exchange_weak(r, pack(a), o,
+      dpp::detail::atomic_load_order(o)));
+
+    return unpack(r);
+  }
+
+  value_type fetch_max(value_type const& a,
+    memory_order const o = memory_order_seq_cst) noexcept
+  {
+    auto r(a_.load(dpp::detail::atomic_load_order(o)));
+
+    while ((a > unpack(r)) && !a_.compare_exchange_weak(r, pack(a), o,
+      dpp::detail::atomic_load_order(o)));
+
+    return unpack(r);
+  }
+
+  //
+  void wait(value_type const& a,
+    memory_order const o = memory_order_seq_cst) const noexcept
+  {
+    a_.wait(pack(a), o);
+  }
+
+  void notify_one() noexcept { a_.notify_one(); }
+  void notify_all() noexcept { a_.notify_all(); }
+};
+
+}
+
+#endif // DPP_ATOMIC_HPP
@@ -1,14 +1,35 @@
 #include "nanobind/nanobind.h"
+#include "nanobind/ndarray.h"
 #include "nanobind/operators.h"
 #include "nanobind/stl/string.h"
 #include "nanobind/stl/string_view.h"
 
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include "numpy/arrayobject.h"
+#include "numpy/ufuncobject.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
 #include <format>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "sqrt.hpp"
+#include "to_integral.hpp"
+#include "utils.hpp"
 
 namespace nb = nanobind;
 
@@ -16,6 +37,436 @@ namespace nb = nanobind;
 #define STR_HELPER(x) #x
 #define STR(x) STR_HELPER(x)
 
+// numpy user dtypes, the ufunc loops run without the python api
+#if NPY_ABI_VERSION < 0x02000000
+# define PyArray_DescrProto PyArray_Descr
+#endif
+
+template <typename T>
+inline int type_num_v{NPY_NOTYPE};
+
+template <typename T>
+T load(void const* const p) noexcept
+{ // numpy may hand us unaligned data
+  T a;
+  std::memcpy(&a, p, sizeof(T));
+
+  return a;
+}
+
+template <typename T>
+void store(void* const p, T const& a) noexcept
+{
+  std::memcpy(p, &a, sizeof(T));
+}
+
+template <typename T>
+PyObject* getitem(void* const p, void*) noexcept
+{
+  try
+  {
+    return nb::cast(load<T>(p)).release().ptr();
+  }
+  catch (nb::python_error& e)
+  {
+    e.restore();
+  }
+  catch (std::exception const& e)
+  {
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+  }
+
+  return {};
+}
+
+template <typename T>
+int setitem(PyObject* const o, void* const p, void*) noexcept
+{
+  T a;
+
+  if (Py_ssize_t n; PyUnicode_Check(o))
+  {
+    auto const s(PyUnicode_AsUTF8AndSize(o, &n));
+
+    if (!s) return -1;
+
+    a = dpp::to_decimal<T>(std::string_view(s, n));
+  }
+  else if (!nb::try_cast<T>(nb::handle(o), a))
+  {
+    PyErr_SetString(PyExc_TypeError, "not convertible to a decimal");
+
+    return -1;
+  }
+
+  return store(p, a), 0;
+}
+
+template <typename T>
+void copyswapn(void* const dst, npy_intp const ds, void* const src,
+  npy_intp const ss, npy_intp const n, int, void*) noexcept
+{ // the byte order is not applicable, there is nothing to swap
+  if (src)
+  {
+    auto d(static_cast<char*>(dst));
+    auto s(static_cast<char const*>(src));
+
+    for (npy_intp i{}; n != i; ++i, d += ds, s += ss)
+      std::memcpy(d, s, sizeof(T));
+  }
+}
+
+template <typename T>
+void copyswap(void* const dst, void* const src, int, void*) noexcept
+{
+  if (src) std::memcpy(dst, src, sizeof(T));
+}
+
+template <typename T>
+int compare(void const* const p, void const* const q, void*) noexcept
+{ // nans sort last
+  auto const a(load<T>(p)), b(load<T>(q));
+
+  return dpp::isnan(a) ? !dpp::isnan(b) : dpp::isnan(b) ? -1 :
+    a < b ? -1 : b < a;
+}
+
+template <typename T>
+npy_bool nonzero(void* const p, void*) noexcept
+{
+  return bool(load<T>(p));
+}
+
+template <typename T>
+void dotfunc(void* const a, npy_intp const as, void* const b,
+  npy_intp const bs, void* const r, npy_intp const n, void*) noexcept
+{
+  T s{};
+
+  for (npy_intp i{}; n != i; ++i)
+    s = dpp::fma(load<T>(static_cast<char const*>(a) + i * as),
+      load<T>(static_cast<char const*>(b) + i * bs), s);
+
+  store(r, s);
+}
+
+template <typename T, typename F, std::size_t ...I>
+void ufunc_loop(char** const args, npy_intp const* const d,
+  npy_intp const* const s, void*) noexcept
+{
+  constexpr auto N(sizeof...(I));
+
+  for (npy_intp i{}; d[0] != i; ++i)
+  {
+    auto const r(F()(load<T>(args[I] + i * s[I])...));
+
+    if constexpr(std::is_same_v<decltype(r), bool const>)
+      store(args[N] + i * s[N], npy_bool(r));
+    else
+      store(args[N] + i * s[N], r);
+  }
+}
+
+template <typename T, typename F, std::size_t ...I>
+void register_loop(nb::module_ const& np, char const* const name,
+  int const out)
+{
+  int t[]{(void(I), type_num_v<T>)..., out};
+
+  if (PyUFunc_RegisterLoopForType(
+    reinterpret_cast<PyUFuncObject*>(np.attr(name).ptr()), type_num_v<T>,
+    ufunc_loop<T, F, I...>, t, nullptr) < 0) throw nb::python_error();
+}
+
+template <typename A, typename B>
+void cast(void* const from, void* const to, npy_intp const n, void*,
+  void*) noexcept
+{ // the existing constructors and conversion operators
+  for (npy_intp i{}; n != i; ++i)
+    store(static_cast<char*>(to) + i * sizeof(B),
+      B(load<A>(static_cast<char const*>(from) + i * sizeof(A))));
+}
+
+template <typename A, typename B>
+void register_cast(int const from, int const to, auto const ...s)
+{ // safe for the scalar kinds s..., NPY_NOSCALAR makes it safe for arrays
+  auto const d(PyArray_DescrFromType(from));
+
+  if (!d || (PyArray_RegisterCastFunc(d, to, cast<A, B>) < 0) ||
+    ((PyArray_RegisterCanCast(d, to, s) < 0) || ...))
+  {
+    Py_XDECREF(d);
+
+    throw nb::python_error();
+  }
+
+  Py_DECREF(d);
+}
+
+template <typename T>
+void register_dtype(nb::handle const cl, auto const& name)
+{
+  static PyArray_ArrFuncs f;
+
+  PyArray_InitArrFuncs(&f);
+
+  f.getitem = getitem<T>;
+  f.setitem = setitem<T>;
+  f.copyswapn = copyswapn<T>;
+  f.copyswap = copyswap<T>;
+  f.compare = compare<T>;
+  f.nonzero = nonzero<T>;
+  f.dotfunc = dotfunc<T>;
+
+  // numpy wants a subclass of np.generic as the scalar type, the values
+  // themselves are returned as instances of the bound class
+  static auto const sname(std::format(STR(MOD_NAME)".{}_generic", name));
+
+  static PyType_Slot slots[]{{0, nullptr}};
+  static PyType_Spec spec{sname.c_str(), 0, 0, Py_TPFLAGS_DEFAULT, slots};
+
+  static PyArray_DescrProto d{};
+
+  Py_SET_TYPE(&d, &PyArrayDescr_Type);
+  Py_SET_REFCNT(&d, 1);
+
+  if (nb::object const b(nb::make_tuple(nb::handle(
+    reinterpret_cast<PyObject*>(&PyGenericArrType_Type))));
+    !(d.typeobj = reinterpret_cast<PyTypeObject*>(
+    PyType_FromSpecWithBases(&spec, b.ptr())))) throw nb::python_error();
+
+  d.kind = 'V';
+  d.type = 'V';
+  d.byteorder = '|';
+  d.flags = NPY_USE_GETITEM | NPY_USE_SETITEM;
+  d.elsize = sizeof(T);
+  d.alignment = alignof(T);
+  d.f = &f;
+
+  if ((type_num_v<T> = PyArray_RegisterDataType(&d)) < 0)
+    throw nb::python_error();
+
+  // casts, only the lossless ones are safe for arrays: int64 fits the
+  // significand of d64 and wider (-2^63 aside, it rounds on d64); doubles
+  // and the ints of narrower types round, they are safe for python scalars
+  // only, as in d * 1.5, and otherwise need astype()
+  register_cast<double, T>(NPY_DOUBLE, type_num_v<T>, NPY_FLOAT_SCALAR);
+
+  if constexpr(ar::bit_size_v<typename T::sig_t> >=
+    ar::bit_size_v<npy_int64>)
+    register_cast<npy_int64, T>(NPY_INT64, type_num_v<T>, NPY_NOSCALAR);
+  else
+    register_cast<npy_int64, T>(NPY_INT64, type_num_v<T>, NPY_INTPOS_SCALAR,
+      NPY_INTNEG_SCALAR);
+
+  register_cast<T, double>(type_num_v<T>, NPY_DOUBLE);
+  register_cast<T, npy_int64>(type_num_v<T>, NPY_INT64);
+
+  // ufuncs, add also provides sum()
+  {
+    auto const np(nb::module_::import_("numpy"));
+
+    register_loop<T, std::plus<>, 0, 1>(np, "add", type_num_v<T>);
+    register_loop<T, std::minus<>, 0, 1>(np, "subtract", type_num_v<T>);
+    register_loop<T, std::multiplies<>, 0, 1>(np, "multiply", type_num_v<T>);
+    register_loop<T, std::divides<>, 0, 1>(np, "divide", type_num_v<T>);
+    register_loop<T, std::negate<>, 0>(np, "negative", type_num_v<T>);
+
+    constexpr auto abs([](T const& a) noexcept { return dpp::abs(a); });
+    constexpr auto sqrt([](T const& a) noexcept { return dpp::sqrt(a); });
+    constexpr auto isnan([](T const& a) noexcept { return dpp::isnan(a); });
+
+    register_loop<T, decltype(abs), 0>(np, "absolute", type_num_v<T>);
+    register_loop<T, decltype(sqrt), 0>(np, "sqrt", type_num_v<T>);
+    register_loop<T, decltype(isnan), 0>(np, "isnan", NPY_BOOL);
+
+    register_loop<T, std::equal_to<>, 0, 1>(np, "equal", NPY_BOOL);
+    register_loop<T, std::not_equal_to<>, 0, 1>(np, "not_equal", NPY_BOOL);
+    register_loop<T, std::less<>, 0, 1>(np, "less", NPY_BOOL);
+    register_loop<T, std::less_equal<>, 0, 1>(np, "less_equal", NPY_BOOL);
+    register_loop<T, std::greater<>, 0, 1>(np, "greater", NPY_BOOL);
+    register_loop<T, std::greater_equal<>, 0, 1>(np, "greater_equal",
+      NPY_BOOL);
+  }
+
+  // np.dtype(dpp.d64) looks up the dtype attribute
+  cl.attr("dtype") = nb::steal(
+    reinterpret_cast<PyObject*>(PyArray_DescrFromType(type_num_v<T>)));
+}
+
+// python ints and decimals, without going through text
+inline nb::handle decimal_t; // decimal.Decimal
+
+inline bool is_decimal(PyObject* const o) noexcept
+{
+  return PyObject_TypeCheck(o, reinterpret_cast<PyTypeObject*>(
+    decimal_t.ptr()));
+}
+
+class decimal_: public nb::object
+{
+  NB_OBJECT_DEFAULT(decimal_, object, "decimal.Decimal", is_decimal)
+};
+
+template <typename T>
+auto clamp_exp(long long const e) noexcept
+{ // far enough out of range to over- or underflow
+  using F = typename T::exp2_t;
+
+  return F(std::clamp<long long>(e, std::numeric_limits<F>::min() / 2,
+    std::numeric_limits<F>::max() / 2));
+}
+
+template <typename T>
+T from_digits(bool const neg, std::size_t const n, auto const digit,
+  typename T::exp2_t e = {})
+{ // digit(i), most significant first, the digits beyond sig2_t are folded
+  // into a sticky digit, rounding happens once
+  using U = typename T::sig2_t;
+  using F = typename T::exp2_t;
+
+  constexpr std::size_t k(dpp::detail::maxpow10e<U>() - 1);
+
+  U m{};
+  std::size_t i{};
+
+  for (auto const j(std::min(n, k)); j != i; ++i) m = U(10) * m + U(digit(i));
+
+  if (n != i)
+  {
+    bool x{};
+
+    for (; !x && (n != i); ++i) x = digit(i);
+
+    e += F(n - k);
+
+    if (x) m = U(10) * m + U(1), --e;
+  }
+
+  return T(neg ? U(-m) : m, e);
+}
+
+template <typename T>
+T from_int(nb::handle const o, typename T::exp2_t const e = {})
+{ // small ints directly, then two's complement limbs, then the digits
+  static_assert(std::endian::little == std::endian::native);
+
+  using U = typename T::sig2_t;
+
+  int overflow;
+
+  if (auto const a(PyLong_AsLongLongAndOverflow(o.ptr(), &overflow));
+    !overflow)
+  {
+    if ((-1 == a) && PyErr_Occurred()) throw nb::python_error();
+
+    return T(a, e);
+  }
+  else if (nb::cast<std::size_t>(o.attr("bit_length")()) <
+    ar::bit_size_v<U>)
+  {
+    U m;
+
+    nb::object x(nb::borrow(o));
+    nb::int_ const s(64);
+
+    for (std::size_t i{}; sizeof(m) > i; i += 8)
+    {
+      auto const l(PyLong_AsUnsignedLongLongMask(x.ptr()));
+
+      if ((-1ull == l) && PyErr_Occurred()) throw nb::python_error();
+
+      std::memcpy(reinterpret_cast<std::byte*>(&m) + i, &l,
+        std::min(sizeof(l), sizeof(m) - i));
+
+      if (!(x = nb::steal(PyNumber_Rshift(x.ptr(), s.ptr()))).is_valid())
+        throw nb::python_error();
+    }
+
+    return T(m, e);
+  }
+  else
+  {
+    auto const a(nb::steal(PyNumber_Absolute(o.ptr())));
+
+    if (!a.is_valid()) throw nb::python_error();
+
+    nb::str const t(a);
+    std::string_view const s(t.c_str());
+
+    return from_digits<T>(overflow < 0, s.size(),
+      [&](std::size_t const i) noexcept { return s[i] - '0'; }, e);
+  }
+}
+
+template <typename T>
+T from_decimal(nb::handle const o)
+{ // as_tuple(): sign, digits, exponent, a str for nans and infinities
+  auto const t(nb::cast<nb::tuple>(o.attr("as_tuple")()));
+  auto const d(nb::cast<nb::tuple>(t[1]));
+
+  if (!PyLong_Check(t[2].ptr())) return dpp::nan;
+
+  return from_digits<T>(nb::cast<int>(t[0]), d.size(),
+    [&](std::size_t const i) noexcept {
+      return PyLong_AsLong(PyTuple_GET_ITEM(d.ptr(), i));
+    },
+    clamp_exp<T>(nb::cast<long long>(t[2])));
+}
+
+template <typename T>
+nb::object to_pyint(T const& a)
+{ // truncates
+  static_assert(std::endian::little == std::endian::native);
+
+  if (dpp::isnan(a)) throw nb::value_error("cannot convert nan to integer");
+
+  auto const t(dpp::trunc(a));
+  auto const m(t.sig());
+
+  nb::object r;
+
+  if constexpr(std::integral<typename T::sig_t>)
+    r = nb::int_(std::int64_t(m));
+  else
+    r = nb::handle(reinterpret_cast<PyObject*>(&PyLong_Type)).attr(
+      "from_bytes")(nb::bytes(&m, sizeof(m)), "little",
+      nb::arg("signed") = true);
+
+  if (t.exp() > 0)
+  {
+    nb::int_ const b(10), e(t.exp());
+
+    if (nb::object const p(nb::steal(PyNumber_Power(b.ptr(), e.ptr(),
+      Py_None))); !p.is_valid() ||
+      !(r = nb::steal(PyNumber_Multiply(r.ptr(), p.ptr()))).is_valid())
+      throw nb::python_error();
+  }
+
+  return r;
+}
+
+template <typename T>
+nb::object to_pydecimal(T const& a)
+{ // Decimal((sign, digits, exponent)) is exact
+  if (dpp::isnan(a))
+    return decimal_t(nb::make_tuple(0, nb::make_tuple(), "n"));
+
+  char s[ar::bit_size_v<typename T::sig_t> / 3 + 2];
+
+  auto const r(dpp::to_chars(s, s + sizeof(s), T(dpp::direct, a.sig())));
+  auto const neg('-' == *s);
+
+  auto const d(nb::steal<nb::tuple>(PyTuple_New(r.ptr - s - neg)));
+
+  if (!d.is_valid()) throw nb::python_error();
+
+  for (auto p(s + neg); r.ptr != p; ++p)
+    PyTuple_SET_ITEM(d.ptr(), p - s - neg, PyLong_FromLong(*p - '0'));
+
+  return decimal_t(nb::make_tuple(int(neg), d, a.exp()));
+}
+
 template <typename T>
 void bind_decimal(nb::module_ &m, auto const& name) {
   auto cl = nb::class_<T>(m, name, nb::is_final())
@@ -28,11 +479,22 @@ void bind_decimal(nb::module_ &m, auto const& name) {
     .def(nb::init<dpp::nan_t>())
     .def(nb::init<bool>())
     .def(nb::init<std::intmax_t>())
+    .def("__init__", [](T* const t, nb::int_ const& a) {
+      static_assert(std::is_trivially_default_constructible_v<T>);
+      *t = from_int<T>(a);
+    })
     .def(nb::init<double>())
     .def("__init__", [](T* const t, std::string_view const& s) {
       static_assert(std::is_trivially_default_constructible_v<T>);
       *t = dpp::to_decimal<T>(s);
     })
+    .def("__init__", [](T* const t, decimal_ const& a) {
+      static_assert(std::is_trivially_default_constructible_v<T>);
+      *t = from_decimal<T>(a);
+    })
+    .def_static("from_parts", [](nb::int_ const& c, long long const e) {
+        return from_int<T>(c, clamp_exp<T>(e));
+      }, nb::arg("coefficient"), nb::arg("exponent"))
 
     .def(nb::init_implicit<dpp::nan_t>())
     .def(nb::init_implicit<bool>())
@@ -61,44 +523,999 @@ void bind_decimal(nb::module_ &m, auto const& name) {
     .def(nb::self >= nb::self)
 
     .def("__bool__", [](T const& a) noexcept { return bool(a); })
-    //.def("__int__", [](T const& a) noexcept { return std::intmax_t(a); })
     .def("to_int", [](T const& a) noexcept { return std::intmax_t(a); })
+    .def("__int__", to_pyint<T>)
+    .def("to_decimal", to_pydecimal<T>)
     .def("__float__", [](T const& a) noexcept { return double(a); })
     .def("__hash__", [](T const& a) noexcept { return std::hash<T>{}(a); })
 
     .def("__repr__", [&name](T const& a) {
       return std::format(STR(MOD_NAME)".{}(\"{}\")", name, dpp::to_string(a));
     })
-    .def("__str__", [](T const& a) { return dpp::to_string(a); })
+    .def("__str__", [](T const& a) {
+      char s[64];
+
+      auto const r(dpp::to_chars(s, s + sizeof(s), a));
+
+      return std::errc{} == r.ec ? nb::str(s, r.ptr - s) :
+        nb::str(dpp::to_string(a).c_str());
+    })
 
     .def("__copy__", [](T const& self) noexcept { return T(self); })
     .def("__deepcopy__", [](T const& self, nb::dict const&) noexcept {
       return T(self);
     })
 
-    .def("__getstate__", [](T const& a) { return dpp::to_string(a); })
+    .def("__getstate__", [](T const& a) { // the raw (sig, exp) pair
+      if constexpr(std::integral<typename T::sig_t>)
+        return nb::make_tuple(a.sig(), a.exp());
+      else
+        return nb::make_tuple(nb::bytes(&a.m_, sizeof(a.m_)), a.exp());
+    })
+    .def("__setstate__", [](T& a, nb::tuple const& s) {
+      static_assert(std::is_trivially_default_constructible_v<T>);
+      using sig_t = typename T::sig_t;
+
+      if (2 != s.size()) throw nb::value_error("invalid state");
+
+      sig_t m;
+
+      if constexpr(std::integral<sig_t>)
+        m = nb::cast<sig_t>(s[0]);
+      else if (auto const b(nb::cast<nb::bytes>(s[0])); sizeof(m) == b.size())
+        std::memcpy(&m, b.c_str(), sizeof(m));
+      else
+        throw nb::value_error("invalid state");
+
+      a = T(dpp::direct, m, nb::cast<typename T::exp_t>(s[1]));
+    })
     .def("__setstate__", [](T& a, std::string_view const& s) noexcept {
       static_assert(std::is_trivially_default_constructible_v<T>);
-      a = dpp::to_decimal<T>(s);
+      a = dpp::to_decimal<T>(s); // text, as pickled by older versions
+    });
+
+  // ints without a temporary decimal object; the in-place operators mutate
+  // the left operand, so copy.copy() a value that is shared, e.g. a dict key
+#define DPP_DECIMAL_ARITHMETIC__(F, OP, ROP, IOP)\
+  cl.def(OP, [](T const& a, std::intmax_t const b) noexcept {\
+      return F()(a, T(b));\
+    }, nb::is_operator())\
+    .def(ROP, [](T const& a, std::intmax_t const b) noexcept {\
+      return F()(T(b), a);\
+    }, nb::is_operator())\
+    .def(IOP, [](nb::handle_t<T> const a, T const& b) {\
+      auto& c(*nb::inst_ptr<T>(a)); c = F()(c, b); return nb::borrow(a);\
+    }, nb::is_operator())\
+    .def(IOP, [](nb::handle_t<T> const a, std::intmax_t const b) {\
+      auto& c(*nb::inst_ptr<T>(a)); c = F()(c, T(b)); return nb::borrow(a);\
+    }, nb::is_operator());
+
+  DPP_DECIMAL_ARITHMETIC__(std::plus<>, "__add__", "__radd__", "__iadd__")
+  DPP_DECIMAL_ARITHMETIC__(std::minus<>, "__sub__", "__rsub__", "__isub__")
+  DPP_DECIMAL_ARITHMETIC__(std::multiplies<>, "__mul__", "__rmul__",
+    "__imul__")
+  DPP_DECIMAL_ARITHMETIC__(std::divides<>, "__truediv__", "__rtruediv__",
+    "__itruediv__")
+
+  register_dtype<T>(cl, name);
+
+  m.def("isnan", [](T const& a) noexcept { return dpp::isnan(a); });
+
+  m.def("abs", [](T const& a) noexcept { return dpp::abs(a); });
+  m.def("trunc", [](T const& a) noexcept { return dpp::trunc(a); });
+  m.def("floor", [](T const& a) noexcept { return dpp::floor(a); });
+  m.def("ceil", [](T const& a) noexcept { return dpp::ceil(a); });
+  m.def("round", [](T const& a) noexcept { return dpp::round(a); });
+
+  m.def("inv", [](T const& a) noexcept { return dpp::inv(a); });
+
+  m.def("fma", [](T const& a, T const& b, T const& c) noexcept {
+    return dpp::fma(a, b, c);
+  });
+  m.def("midpoint", [](T const& a, T const& b) noexcept {
+    return dpp::midpoint(a, b);
+  });
+
+  m.def("sqrt", [](T const& a) noexcept { return dpp::sqrt(a); });
+
+  // utils.hpp, exact scaling without a division
+  m.def("div2", [](T const& a) noexcept { return dpp::div2(a); });
+  m.def("div4", [](T const& a) noexcept { return dpp::div4(a); });
+  m.def("div5", [](T const& a) noexcept { return dpp::div5(a); });
+  m.def("div8", [](T const& a) noexcept { return dpp::div8(a); });
+  m.def("div10", [](T const& a) noexcept { return dpp::div10(a); });
+  m.def("mul2", [](T const& a) noexcept { return dpp::mul2(a); });
+
+  m.def("to_integral", [](T const& a) { // truncates, like int()
+    auto const [n, o](dpp::to_integral(a));
+
+    if (o) throw std::overflow_error("nan or out of range");
+
+    return n;
+  });
+}
+
+// bulk operations release the gil and are split into fixed blocks, that
+// the calling thread and a pool of native threads work off; the blocks do
+// not depend on the number of threads, neither do the results
+inline constexpr std::size_t block_size{1 << 14};
+
+class thread_pool
+{
+  std::mutex m_, r_;
+  std::condition_variable cv_, done_;
+
+  std::vector<std::thread> t_;
+
+  void (*f_)(void const*, std::size_t) noexcept{};
+  void const* c_{};
+  std::size_t n_{};
+
+  std::atomic<std::size_t> next_;
+  std::size_t active_{};
+  std::uint64_t gen_{};
+  bool open_{}, stop_{};
+
+  void work() noexcept
+  {
+    std::unique_lock l(m_);
+
+    for (std::uint64_t g{};;)
+    {
+      cv_.wait(l, [&]() noexcept { return stop_ || (open_ && (g != gen_)); });
+
+      if (stop_) break;
+
+      g = gen_;
+      ++active_;
+
+      auto const f(f_);
+      auto const c(c_);
+      auto const n(n_);
+
+      l.unlock();
+
+      for (auto i(next_++); i < n; i = next_++) f(c, i);
+
+      l.lock();
+
+      if (!--active_) done_.notify_all();
+    }
+  }
+
+  void stop()
+  {
+    {
+      std::lock_guard l(m_);
+      stop_ = true;
+    }
+
+    cv_.notify_all();
+
+    for (auto& t: t_) t.join();
+
+    t_.clear();
+    stop_ = false;
+  }
+
+public:
+  explicit thread_pool(std::size_t const n) { resize(n); }
+  ~thread_pool() { stop(); }
+
+  auto size() const noexcept { return t_.size() + 1; }
+
+  void resize(std::size_t n)
+  { // the calling thread counts as one
+    std::lock_guard l(r_);
+
+    stop();
+
+    for (n = std::max(n, std::size_t(1)); size() != n;)
+      t_.emplace_back([this]() noexcept { work(); });
+  }
+
+  void run(std::size_t const n,
+    void (* const f)(void const*, std::size_t) noexcept,
+    void const* const c) noexcept
+  { // f(c, i) for i in [0, n)
+    std::unique_lock r(r_, std::try_to_lock);
+
+    if (!r || t_.empty() || (n < 2))
+    { // busy with another caller, work alone
+      for (std::size_t i{}; n != i; ++i) f(c, i);
+
+      return;
+    }
+
+    {
+      std::lock_guard l(m_);
+
+      f_ = f;
+      c_ = c;
+      n_ = n;
+      next_ = 0;
+
+      ++gen_;
+      open_ = true;
+    }
+
+    cv_.notify_all();
+
+    for (auto i(next_++); i < n; i = next_++) f(c, i);
+
+    std::unique_lock l(m_);
+
+    open_ = false;
+    done_.wait(l, [&]() noexcept { return !active_; });
+  }
+
+  void run(std::size_t const n, auto const& f) noexcept
+  {
+    run(
+      n,
+      [](void const* const c, std::size_t const i) noexcept
+      {
+        (*static_cast<std::remove_cvref_t<decltype(f)> const*>(c))(i);
+      },
+      &f
+    );
+  }
+};
+
+inline auto& pool()
+{
+  static thread_pool p(std::thread::hardware_concurrency());
+
+  return p;
+}
+
+inline auto blocks(std::size_t const n) noexcept
+{
+  return (n + block_size - 1) / block_size;
+}
+
+void parallel_for(std::size_t const n, auto const& f) noexcept
+{ // f(b, e) over the blocks [b, e)
+  pool().run(
+    blocks(n),
+    [&](std::size_t const i) noexcept
+    {
+      f(i * block_size, std::min(n, (i + 1) * block_size));
+    }
+  );
+}
+
+template <typename T>
+T parallel_reduce(std::size_t const n, auto const& f)
+{ // the partial results are combined in block order
+  std::vector<T> p(blocks(n));
+
+  pool().run(
+    p.size(),
+    [&](std::size_t const i) noexcept
+    {
+      p[i] = f(i * block_size, std::min(n, (i + 1) * block_size));
+    }
+  );
+
+  T s{};
+
+  for (auto const& a: p) s += a;
+
+  return s;
+}
+
+// contiguous arrays, every bulk operation is a native loop
+template <typename T>
+struct array: std::vector<T>
+{
+  using std::vector<T>::vector;
+};
+
+template <typename T>
+using input_t = nb::ndarray<T const, nb::ndim<1>, nb::device::cpu>;
+
+template <typename T>
+using ndarray_t = nb::ndarray<nb::numpy, T, nb::ndim<1>>;
+
+template <typename T>
+constexpr auto const& at(array<T> const& a, std::size_t const i) noexcept
+{
+  return a[i];
+}
+
+constexpr auto const& at(auto const& a, std::size_t) noexcept { return a; }
+
+template <typename T>
+std::size_t common_size(auto const& ...a)
+{ // scalars broadcast
+  std::size_t n(-1);
+
+  (
+    [&]() {
+      if constexpr(std::is_same_v<std::remove_cvref_t<decltype(a)>, array<T>>)
+      {
+        if (std::size_t(-1) == n) n = a.size();
+        else if (n != a.size()) throw nb::value_error("array sizes differ");
+      }
+    }(),
+    ...
+  );
+
+  return n;
+}
+
+template <typename T>
+auto transform(auto const f, auto const& ...a)
+{
+  auto const n(common_size<T>(a...));
+
+  array<T> r(n);
+
+  {
+    nb::gil_scoped_release const g;
+
+    parallel_for(n, [&](std::size_t i, std::size_t const e) noexcept {
+        for (; e != i; ++i) r[i] = f(at(a, i)...);
+      });
+  }
+
+  return r;
+}
+
+template <typename U>
+auto to_ndarray(std::unique_ptr<U[]> p, std::size_t const n)
+{ // the capsule takes ownership of the buffer
+  nb::capsule const o(p.get(),
+    [](void* const p) noexcept { delete[] static_cast<U*>(p); });
+
+  return ndarray_t<U>(p.release(), {n}, o);
+}
+
+template <typename T>
+auto predicate(auto const f, auto const& ...a)
+{
+  auto const n(common_size<T>(a...));
+
+  std::unique_ptr<bool[]> p(new bool[n]);
+
+  {
+    nb::gil_scoped_release const g;
+
+    parallel_for(n, [&](std::size_t i, std::size_t const e) noexcept {
+        for (; e != i; ++i) p[i] = f(at(a, i)...);
+      });
+  }
+
+  return to_ndarray(std::move(p), n);
+}
+
+template <typename T>
+T sum(array<T> const& a)
+{
+  nb::gil_scoped_release const g;
+
+  return parallel_reduce<T>(a.size(),
+    [&](std::size_t i, std::size_t const e) noexcept {
+      T s{};
+
+      for (; e != i; ++i) s += a[i];
+
+      return s;
+    });
+}
+
+template <typename T>
+T dot(array<T> const& a, array<T> const& b)
+{ // a single rounding per term
+  auto const n(common_size<T>(a, b));
+
+  nb::gil_scoped_release const g;
+
+  return parallel_reduce<T>(n,
+    [&](std::size_t i, std::size_t const e) noexcept {
+      T s{};
+
+      for (; e != i; ++i) s = dpp::fma(a[i], b[i], s);
+
+      return s;
+    });
+}
+
+template <typename T, typename M>
+auto member_view(array<T>& a)
+{ // a strided view into the array of structures, valid while a lives
+  static_assert(std::is_standard_layout_v<T>);
+  static_assert(!(sizeof(T) % sizeof(M)));
+
+  constexpr auto o(std::is_same_v<M, typename T::exp_t> ?
+    offsetof(T, e_) : offsetof(T, m_));
+
+  return ndarray_t<M>(reinterpret_cast<std::byte*>(a.data()) + o, {a.size()},
+    nb::handle(), {std::int64_t(sizeof(T) / sizeof(M))});
+}
+
+template <typename T>
+int getbuffer(PyObject* const o, Py_buffer* const v, int const f) noexcept
+{ // the buffer protocol, a record of significand and exponent per element,
+  // without a copy, e.g. np.asarray(a)["sig"]
+  using sig_t = typename T::sig_t;
+  using exp_t = typename T::exp_t;
+
+  static_assert(!offsetof(T, m_) && (sizeof(sig_t) == offsetof(T, e_)));
+
+  constexpr auto c([](std::size_t const n) noexcept
+    {
+      return 1 == n ? 'b' : 2 == n ? 'h' : 4 == n ? 'i' : 'q';
+    }
+  );
+
+  static auto const fmt(std::format("T{{{}:sig:{}:exp:{}x:}}",
+    c(sizeof(sig_t)), c(sizeof(exp_t)),
+    sizeof(T) - sizeof(sig_t) - sizeof(exp_t)));
+
+  auto& a(*nb::inst_ptr<array<T>>(o));
+
+  // shape and strides, freed by releasebuffer()
+  auto const s(new (std::nothrow) Py_ssize_t[2]{Py_ssize_t(a.size()),
+    Py_ssize_t(sizeof(T))});
+
+  if (!s)
+  {
+    PyErr_NoMemory();
+
+    return v->obj = nullptr, -1;
+  }
+
+  v->buf = a.data();
+  v->obj = o;
+  v->len = Py_ssize_t(a.size() * sizeof(T));
+  v->readonly = 0;
+  v->itemsize = sizeof(T);
+  v->format = f & PyBUF_FORMAT ? const_cast<char*>(fmt.c_str()) : nullptr;
+  v->ndim = 1;
+  v->shape = (f & PyBUF_ND) == PyBUF_ND ? s : nullptr;
+  v->strides = (f & PyBUF_STRIDES) == PyBUF_STRIDES ? s + 1 : nullptr;
+  v->suboffsets = nullptr;
+  v->internal = s;
+
+  Py_INCREF(o);
+
+  return 0;
+}
+
+inline void releasebuffer(PyObject*, Py_buffer* const v) noexcept
+{
+  delete[] static_cast<Py_ssize_t*>(v->internal);
+}
+
+template <typename T>
+auto buffer_slots() noexcept
+{ // no struct format character for the intt significands
+  if constexpr(std::integral<typename T::sig_t>)
+  {
+    static PyType_Slot s[]{
+      {Py_bf_getbuffer, reinterpret_cast<void*>(getbuffer<T>)},
+      {Py_bf_releasebuffer, reinterpret_cast<void*>(releasebuffer)},
+      {0, nullptr}
+    };
+
+    return s;
+  }
+  else
+  {
+    static PyType_Slot s[]{{0, nullptr}};
+
+    return s;
+  }
+}
+
+template <typename T>
+T parse(char const* b, char const* const e) noexcept
+{ // leading blanks are skipped, to_decimal() stops at trailing ones
+  for (; (e != b) && ((' ' == *b) || ('\t' == *b)); ++b);
+
+  return dpp::to_decimal<T>(b, e);
+}
+
+template <typename T>
+auto from_strings(std::string_view const s, std::string_view const sep)
+{ // a field starts at 0 and after every separator, except at the end
+  if (1 != sep.size())
+    throw nb::value_error("the separator must be a single character");
+
+  auto const c(sep.front());
+  auto const b(s.data()), e(b + s.size());
+
+  // block i owns the fields starting in it
+  auto const fields([&](std::size_t const i, auto f) noexcept
+    {
+      auto p(b + i * block_size);
+
+      if (i && (c != p[-1]))
+      {
+        p = static_cast<char const*>(std::memchr(p, c, e - p));
+        p = p ? p + 1 : e;
+      }
+
+      for (auto const q(b + std::min(s.size(), (i + 1) * block_size));
+        p < q;)
+      {
+        auto const r(static_cast<char const*>(std::memchr(p, c, e - p)));
+
+        f(p, r ? r : e);
+
+        if (!r) break;
+
+        p = r + 1;
+      }
+    }
+  );
+
+  std::vector<std::size_t> o(blocks(s.size()) + 1);
+
+  nb::gil_scoped_release const g;
+
+  pool().run(o.size() - 1, [&](std::size_t const i) noexcept {
+      fields(i, [&](char const*, char const*) noexcept { ++o[i + 1]; });
+    });
+
+  for (std::size_t i(1); o.size() != i; ++i) o[i] += o[i - 1];
+
+  array<T> r(o.back());
+
+  pool().run(o.size() - 1, [&](std::size_t const i) noexcept {
+      fields(i, [&, j(o[i])](char const* const p, char const* const q)
+        mutable noexcept { r[j++] = parse<T>(p, q); });
+    });
+
+  return r;
+}
+
+template <typename T>
+auto from_strings(nb::handle const s)
+{ // a snapshot keeps the strings alive, while the gil is released
+  auto const t(nb::steal<nb::tuple>(PySequence_Tuple(s.ptr())));
+
+  if (!t.is_valid()) throw nb::python_error();
+
+  std::vector<std::string_view> v;
+  v.reserve(t.size());
+
+  for (auto const h: t)
+  {
+    char* p;
+    Py_ssize_t n;
+
+    if (PyBytes_Check(h.ptr()))
+      PyBytes_AsStringAndSize(h.ptr(), &p, &n);
+    else if (!(p = const_cast<char*>(PyUnicode_AsUTF8AndSize(h.ptr(), &n))))
+      throw nb::python_error();
+
+    v.emplace_back(p, n);
+  }
+
+  array<T> r(v.size());
+
+  {
+    nb::gil_scoped_release const g;
+
+    parallel_for(v.size(), [&](std::size_t i, std::size_t const e) noexcept {
+        for (; e != i; ++i) r[i] = parse<T>(v[i].data(), v[i].data() +
+          v[i].size());
+      });
+  }
+
+  return r;
+}
+
+template <typename T>
+auto format_blocks(array<T> const& a, std::string_view const sep)
+{ // a buffer per block, every value is followed by sep
+  std::vector<std::string> r(blocks(a.size()));
+
+  nb::gil_scoped_release const g;
+
+  pool().run(r.size(), [&](std::size_t const i) noexcept {
+      auto& s(r[i]);
+
+      for (auto j(i * block_size), e(std::min(a.size(), j + block_size));
+        e != j; ++j)
+      {
+        auto const o(s.size());
+
+        s.resize(o + 64);
+
+        if (auto const [p, ec](dpp::to_chars(s.data() + o,
+          s.data() + s.size(), a[j])); std::errc{} == ec) [[likely]]
+          s.resize(p - s.data());
+        else
+          s.resize(o), s.append(dpp::to_string(a[j]));
+
+        s.append(sep);
+      }
+    });
+
+  return r;
+}
+
+template <typename T>
+nb::bytes to_strings(array<T> const& a, std::string_view const sep)
+{
+  auto const r(format_blocks(a, sep));
+
+  std::size_t n{};
+
+  for (auto const& s: r) n += s.size();
+
+  auto b(nb::steal<nb::bytes>(PyBytes_FromStringAndSize(nullptr, n)));
+
+  if (!b.is_valid()) throw nb::python_error();
+
+  for (auto p(PyBytes_AS_STRING(b.ptr())); auto const& s: r)
+    p = std::copy(s.begin(), s.end(), p);
+
+  return b;
+}
+
+template <typename T>
+nb::list to_strings(array<T> const& a)
+{ // formatted text never contains a 0
+  auto const r(format_blocks(a, {"", 1}));
+
+  auto l(nb::steal<nb::list>(PyList_New(a.size())));
+
+  if (!l.is_valid()) throw nb::python_error();
+
+  Py_ssize_t i{};
+
+  for (auto const& s: r)
+  {
+    for (auto p(s.data()), e(p + s.size()); e != p; ++i)
+    {
+      auto const q(static_cast<char const*>(std::memchr(p, '\0', e - p)));
+
+      auto const o(PyUnicode_FromStringAndSize(p, q - p));
+
+      if (!o) throw nb::python_error();
+
+      PyList_SET_ITEM(l.ptr(), i, o);
+
+      p = q + 1;
+    }
+  }
+
+  return l;
+}
+
+template <typename T>
+auto to_raw(array<T> const& a)
+{ // contiguous copies of the significands and exponents
+  auto const n(a.size());
+
+  std::unique_ptr<std::int64_t[]> m(new std::int64_t[n]);
+  std::unique_ptr<std::int16_t[]> e(new std::int16_t[n]);
+
+  {
+    nb::gil_scoped_release const g;
+
+    parallel_for(n, [&](std::size_t i, std::size_t const f) noexcept {
+        for (; f != i; ++i) m[i] = a[i].sig(), e[i] = a[i].exp();
+      });
+  }
+
+  return nb::make_tuple(to_ndarray(std::move(m), n),
+    to_ndarray(std::move(e), n));
+}
+
+template <typename T>
+auto from_raw(input_t<std::int64_t> const& m, input_t<std::int16_t> const& e)
+{ // the exponent of a nan is emin
+  auto const vm(m.view());
+  auto const ve(e.view());
+
+  if (vm.shape(0) != ve.shape(0)) throw nb::value_error("array sizes differ");
+
+  array<T> r(vm.shape(0));
+
+  {
+    nb::gil_scoped_release const g;
+
+    parallel_for(r.size(), [&](std::size_t i, std::size_t const f) noexcept {
+        for (; f != i; ++i)
+          r[i] = T::emin == ve(i) ? T(dpp::nan) :
+            T(typename T::sig2_t(vm(i)), typename T::exp2_t(ve(i)));
+      });
+  }
+
+  return r;
+}
+
+template <typename T>
+auto to_decimal128(array<T> const& a, int const scale, int const precision)
+{ // arrow decimal128(precision, scale): a validity bitmap and 16 byte little
+  // endian integers a * 10^scale, rounded like the type, nans are nulls
+  static_assert(std::endian::little == std::endian::native);
+
+  using V = unsigned __int128;
+  using F = typename T::exp2_t;
+
+  static constexpr auto p10(
+    []() noexcept
+    {
+      std::array<V, 39> p{1};
+
+      for (std::size_t i(1); p.size() != i; ++i) p[i] = 10 * p[i - 1];
+
+      return p;
+    }()
+  );
+
+  if ((precision < 1) || (precision > 38))
+    throw nb::value_error("the precision must be in [1, 38]");
+
+  auto const n(a.size());
+
+  std::unique_ptr<std::uint8_t[]> b(new std::uint8_t[(n + 7) / 8]{});
+  std::unique_ptr<std::uint8_t[]> v(new std::uint8_t[16 * n]);
+
+  std::atomic<bool> overflow{};
+
+  {
+    nb::gil_scoped_release const g;
+
+    // blocks own whole bytes of the bitmap
+    static_assert(!(block_size % 8));
+
+    parallel_for(n, [&](std::size_t i, std::size_t const f) noexcept {
+        for (; f != i; ++i)
+        {
+          V x{};
+
+          if (!dpp::isnan(a[i]))
+          {
+            auto const q(dpp::quantize(a[i], F(-scale)));
+            auto const s(q.sig());
+            auto const k(F(q.exp()) + scale); // k >= 0
+            V const m(s < 0 ? V(-s) : V(s));
+
+            if (m && ((k > 38) || (m > (p10[precision] - 1) / p10[k])))
+            {
+              overflow.store(true, std::memory_order_relaxed);
+            }
+            else
+            {
+              x = m ? m * p10[k] : V{};
+              if (s < 0) x = -x;
+
+              b[i / 8] |= 1 << i % 8;
+            }
+          }
+
+          std::memcpy(&v[16 * i], &x, 16);
+        }
+      });
+  }
+
+  if (overflow)
+    throw nb::value_error(std::format("a value does not fit decimal128({}, {})",
+      precision, scale).c_str());
+
+  return nb::make_tuple(to_ndarray(std::move(b), (n + 7) / 8),
+    to_ndarray(std::move(v), 16 * n));
+}
+
+template <typename T>
+void bind_array(nb::module_ &m, auto const& name)
+{
+  using A = array<T>;
+
+  using sig_t = typename T::sig_t;
+  using exp_t = typename T::exp_t;
+
+  auto cl = nb::class_<A>(m, name, nb::is_final(),
+    nb::type_slots(buffer_slots<T>()))
+    .def(nb::init<>())
+    .def(nb::init<std::size_t>())
+
+    .def("__init__", [](A* const t, input_t<double> const& a) {
+      auto const v(a.view());
+
+      new (t) A(v.shape(0));
+
+      nb::gil_scoped_release const g;
+
+      parallel_for(t->size(), [&](std::size_t i, std::size_t const e) noexcept {
+          for (; e != i; ++i) (*t)[i] = T(v(i));
+        });
+    })
+    .def("__init__", [](A* const t, input_t<std::int64_t> const& a) {
+      auto const v(a.view());
+
+      new (t) A(v.shape(0));
+
+      nb::gil_scoped_release const g;
+
+      parallel_for(t->size(), [&](std::size_t i, std::size_t const e) noexcept {
+          for (; e != i; ++i) (*t)[i] = T(std::intmax_t(v(i)));
+        });
+    })
+    .def("__init__", [](A* const t, nb::iterable const& a) {
+      A r;
+
+      for (auto const h: a) r.push_back(nb::cast<T>(h));
+
+      new (t) A(std::move(r));
+    })
+
+    .def("__len__", [](A const& a) noexcept { return a.size(); })
+    .def("__getitem__", [](A const& a, std::ptrdiff_t i) {
+      if (i < 0) i += std::ptrdiff_t(a.size());
+
+      if ((i < 0) || (std::size_t(i) >= a.size()))
+        throw nb::index_error("index out of range");
+
+      return a[i];
+    })
+    .def("__setitem__", [](A& a, std::ptrdiff_t i, T const& b) {
+      if (i < 0) i += std::ptrdiff_t(a.size());
+
+      if ((i < 0) || (std::size_t(i) >= a.size()))
+        throw nb::index_error("index out of range");
+
+      a[i] = b;
+    })
+
+    .def_prop_ro("exp", member_view<T, exp_t>,
+      nb::rv_policy::reference_internal)
+
+    .def("to_float", [](A const& a) {
+      std::unique_ptr<double[]> p(new double[a.size()]);
+
+      {
+        nb::gil_scoped_release const g;
+
+        parallel_for(a.size(),
+          [&](std::size_t i, std::size_t const e) noexcept {
+            for (; e != i; ++i) p[i] = double(a[i]);
+          });
+      }
+
+      return to_ndarray(std::move(p), a.size());
+    })
+
+    .def("sum", sum<T>)
+    .def("dot", dot<T>)
+
+    .def("__getstate__", [](A const& a) { // all significands, all exponents
+      auto b(nb::steal<nb::bytes>(PyBytes_FromStringAndSize(nullptr,
+        a.size() * (sizeof(sig_t) + sizeof(exp_t)))));
+
+      if (!b.is_valid()) throw nb::python_error();
+
+      auto p(PyBytes_AS_STRING(b.ptr()));
+      auto q(p + a.size() * sizeof(sig_t));
+
+      for (auto const& x: a)
+      {
+        std::memcpy(p, &x.m_, sizeof(sig_t)), p += sizeof(sig_t);
+        std::memcpy(q, &x.e_, sizeof(exp_t)), q += sizeof(exp_t);
+      }
+
+      return b;
+    })
+    .def("__setstate__", [](A& a, nb::bytes const& b) {
+      if (b.size() % (sizeof(sig_t) + sizeof(exp_t)))
+        throw nb::value_error("invalid state");
+
+      new (&a) A(b.size() / (sizeof(sig_t) + sizeof(exp_t)));
+
+      auto p(b.c_str());
+      auto q(p + a.size() * sizeof(sig_t));
+
+      for (auto& x: a)
+      {
+        std::memcpy(&x.m_, p, sizeof(sig_t)), p += sizeof(sig_t);
+        std::memcpy(&x.e_, q, sizeof(exp_t)), q += sizeof(exp_t);
+      }
+    })
+
+    .def_static("from_strings", [](nb::bytes const& s,
+      std::string_view const sep) {
+        return from_strings<T>({s.c_str(), s.size()}, sep);
+      }, nb::arg("s"), nb::arg("sep") = "\n")
+    .def_static("from_strings", [](std::string_view const s,
+      std::string_view const sep) {
+        return from_strings<T>(s, sep);
+      }, nb::arg("s"), nb::arg("sep") = "\n")
+    .def_static("from_strings", [](nb::sequence const& s) {
+        return from_strings<T>(s);
+      }, nb::arg("s"))
+
+    .def("__neg__", [](A const& a) {
+      return transform<T>(std::negate<>(), a);
+    })
+    .def("__pos__", [](A const& a) { return A(a); })
+
+    .def("__repr__", [&name](A const& a) {
+      std::string r(std::format(STR(MOD_NAME)".{}([", name));
+
+      for (std::size_t i{}; a.size() != i; ++i)
+        r.append(i ? ", " : "").append(dpp::to_string(a[i]));
+
+      return r.append("])");
     });
 
-  m.def("isnan", dpp::isnan<typename T::sig_t, typename T::exp_t>);
+  if constexpr(std::integral<sig_t>)
+  { // no numpy dtype for the intt significands
+    cl.def_prop_ro("sig", member_view<T, sig_t>,
+      nb::rv_policy::reference_internal);
+
+    // (int64 sig[], int16 exp[]) and arrow decimal128 buffers, e.g.
+    // pa.Array.from_buffers(pa.decimal128(38, 2), len(a),
+    //   [pa.py_buffer(b) for b in a.to_decimal128(2)])
+    cl.def("to_raw", to_raw<T>)
+      .def_static("from_raw", from_raw<T>, nb::arg("sig"), nb::arg("exp"))
+      .def("to_decimal128", to_decimal128<T>, nb::arg("scale"),
+        nb::arg("precision") = 38);
+  }
+
+  // arrays of equal size, scalars broadcast
+#define DPP_ARRAY_ARITHMETIC__(F, OP, ROP)\
+  cl.def(OP, [](A const& a, A const& b) { return transform<T>(F(), a, b); })\
+    .def(OP, [](A const& a, T const& b) { return transform<T>(F(), a, b); })\
+    .def(ROP, [](A const& a, T const& b) { return transform<T>(F(), b, a); });
+
+  DPP_ARRAY_ARITHMETIC__(std::plus<>, "__add__", "__radd__")
+  DPP_ARRAY_ARITHMETIC__(std::minus<>, "__sub__", "__rsub__")
+  DPP_ARRAY_ARITHMETIC__(std::multiplies<>, "__mul__", "__rmul__")
+  DPP_ARRAY_ARITHMETIC__(std::divides<>, "__truediv__", "__rtruediv__")
+
+  // comparisons return numpy bool arrays
+#define DPP_ARRAY_COMPARISON__(F, OP)\
+  cl.def(OP, [](A const& a, A const& b) { return predicate<T>(F(), a, b); })\
+    .def(OP, [](A const& a, T const& b) { return predicate<T>(F(), a, b); });
 
-  m.def("abs", dpp::abs<typename T::sig_t, typename T::exp_t>);
-  m.def("trunc", dpp::trunc<typename T::sig_t, typename T::exp_t>);
-  m.def("floor", dpp::floor<typename T::sig_t, typename T::exp_t>);
-  m.def("ceil", dpp::ceil<typename T::sig_t, typename T::exp_t>);
-  m.def("round", dpp::round<typename T::sig_t, typename T::exp_t>);
+  DPP_ARRAY_COMPARISON__(std::equal_to<>, "__eq__")
+  DPP_ARRAY_COMPARISON__(std::not_equal_to<>, "__ne__")
+  DPP_ARRAY_COMPARISON__(std::less<>, "__lt__")
+  DPP_ARRAY_COMPARISON__(std::less_equal<>, "__le__")
+  DPP_ARRAY_COMPARISON__(std::greater<>, "__gt__")
+  DPP_ARRAY_COMPARISON__(std::greater_equal<>, "__ge__")
 
-  m.def("inv", dpp::inv<typename T::sig_t, typename T::exp_t>);
+  m.def("isnan", [](A const& a) {
+    return predicate<T>([](T const& a) noexcept { return dpp::isnan(a); }, a);
+  });
 
-  m.def("fma", dpp::fma<typename T::sig_t, typename T::exp_t>);
-  m.def("midpoint", dpp::midpoint<typename T::sig_t, typename T::exp_t>);
+  m.def("fma", [](A const& a, A const& b, A const& c) {
+    return transform<T>([](T const& a, T const& b, T const& c) noexcept {
+        return dpp::fma(a, b, c);
+      }, a, b, c);
+  });
 
-  m.def("sqrt", dpp::sqrt<typename T::sig_t, typename T::exp_t>);
+  m.def("sqrt", [](A const& a) {
+    return transform<T>([](T const& a) noexcept { return dpp::sqrt(a); }, a);
+  });
+
+  m.def("sum", sum<T>);
+  m.def("dot", dot<T>);
+
+  m.def("to_strings", [](A const& a) { return to_strings(a); },
+    nb::arg("a"));
+  m.def("to_strings", [](A const& a, std::string_view const sep) {
+      return to_strings(a, sep);
+    }, nb::arg("a"), nb::arg("sep"));
+
+  // dpp.d64.from_strings()
+  nb::type<T>().attr("from_strings") = cl.attr("from_strings");
 }
 
 NB_MODULE(MOD_NAME, m) {
+  if ((_import_array() < 0) || (_import_umath() < 0))
+    throw nb::python_error();
+
+  decimal_t = nb::module_::import_("decimal").attr("Decimal").release();
+
   {
     auto const& name("nan_t");
 
@@ -110,7 +1527,21 @@ NB_MODULE(MOD_NAME, m) {
     m.attr("nan") = dpp::nan;
   }
 
+  m.def("get_num_threads", []() noexcept { return pool().size(); });
+  m.def("set_num_threads", [](std::size_t const n) { pool().resize(n); });
+
+  bind_decimal<dpp::d16>(m, "d16");
+  bind_decimal<dpp::d24>(m, "d24");
   bind_decimal<dpp::d32>(m, "d32");
+  bind_decimal<dpp::d48>(m, "d48");
   bind_decimal<dpp::d64>(m, "d64");
+  bind_decimal<dpp::d96>(m, "d96");
   bind_decimal<dpp::d128>(m, "d128");
+  bind_decimal<dpp::d256>(m, "d256");
+  bind_decimal<dpp::d512>(m, "d512");
+  bind_decimal<dpp::d1024>(m, "d1024");
+
+  bind_array<dpp::d32>(m, "array_d32");
+  bind_array<dpp::d64>(m, "array_d64");
+  bind_array<dpp::d128>(m, "array_d128");
 }
@@ -0,0 +1,322 @@
+#ifndef DPP_COMPLEX_HPP
+# define DPP_COMPLEX_HPP
+# pragma once
+
+#include <algorithm>
+#include <ostream>
+#include <tuple>
+#include <utility>
+
+#include "dot.hpp"
+#include "sqrt.hpp"
+
+namespace dpp
+{
+
+template <typename D>
+struct complex
+{
+  D r_, i_;
+
+  complex() = default;
+
+  constexpr complex(D const& r, D const& i = {}) noexcept: r_(r), i_(i) { }
+
+  constexpr auto& real() const noexcept { return r_; }
+  constexpr auto& imag() const noexcept { return i_; }
+
+  //
+  constexpr complex operator+() const noexcept { return *this; }
+  constexpr complex operator-() const noexcept { return {-r_, -i_}; }
+
+  constexpr auto& operator+=(auto const& o) noexcept
+  {
+    return *this = *this + o;
+  }
+
+  constexpr auto& operator-=(auto const& o) noexcept
+  {
+    return *this = *this - o;
+  }
+
+  constexpr auto& operator*=(auto const& o) noexcept
+  {
+    return *this = *this * o;
+  }
+
+  constexpr auto& operator/=(auto const& o) noexcept
+  {
+    return *this = *this / o;
+  }
+
+  constexpr bool operator==(complex const&) const noexcept = default;
+};
+
+namespace detail
+{
+
+template <typename T, typename E, rounding R>
+constexpr bool escape_step(complex<dpp<T, E, R>>& z,
+  complex<dpp<T, E, R>> const& c) noexcept
+{ // |z| <= 2 ? z = z * z + c : false, the squares are computed once
+  using D = dpp<T, E, R>;
+  using F = typename D::exp2_t;
+
+  if (isnan(z.r_) || isnan(z.i_) || isnan(c.r_) || isnan(c.i_)) [[unlikely]]
+    return false;
+
+  auto const rr(term(z.r_, z.r_)), ii(term(z.i_, z.i_)), ri(term(z.r_, z.i_));
+
+  auto const small([](D const& a) noexcept
+    { // |a| < 1
+      return F(a.e_) + F(digits10(a.m_)) <= F{};
+    }
+  );
+
+  if ((small(z.r_) && small(z.i_)) || (sum<D, T, E, R>(rr, ii) <= 4))
+    [[likely]]
+  {
+    z = {rr.second == ii.second ? // rr - ii is exact
+      sum<D, T, E, R>(std::pair(rr.first - ii.first, rr.second), term(c.r_)) :
+      sum<D, T, E, R>(rr, neg(ii), term(c.r_)),
+      sum<D, T, E, R>(std::pair(ri.first * 2, ri.second), term(c.i_))};
+
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+template <std::size_t B = 8, typename D>
+constexpr void escape_time(std::size_t const n, unsigned* const j,
+  unsigned const max_iter, auto const& init) noexcept
+{ // B independent points are iterated in lockstep, their dependency chains
+  // interleave
+  for (std::size_t k{}; k < n; k += B)
+  {
+    auto const m(std::min(B, n - k));
+
+    complex<D> z[B], c[B];
+    bool a[B]{};
+
+    for (std::size_t i{}; m != i; ++i)
+      std::tie(z[i], c[i]) = init(k + i), j[k + i] = {}, a[i] = true;
+
+    std::size_t l(m);
+
+    for (auto it(max_iter); l && it; --it)
+      for (std::size_t i{}; m != i; ++i)
+        if (a[i])
+        {
+          if (escape_step(z[i], c[i])) ++j[k + i]; else a[i] = false, --l;
+        }
+  }
+}
+
+}
+
+//
+template <typename T, typename E, rounding R>
+constexpr bool isnan(complex<dpp<T, E, R>> const& a) noexcept
+{
+  return isnan(a.r_) || isnan(a.i_);
+}
+
+template <typename D>
+constexpr complex<D> conj(complex<D> const& a) noexcept
+{
+  return {a.r_, -a.i_};
+}
+
+template <typename D>
+constexpr auto real(complex<D> const& a) noexcept { return a.r_; }
+
+template <typename D>
+constexpr auto imag(complex<D> const& a) noexcept { return a.i_; }
+
+// arithmetic
+template <typename D>
+constexpr complex<D> operator+(complex<D> const& a,
+  complex<D> const& b) noexcept
+{
+  return {a.r_ + b.r_, a.i_ + b.i_};
+}
+
+template <typename D>
+constexpr complex<D> operator-(complex<D> const& a,
+  complex<D> const& b) noexcept
+{
+  return {a.r_ - b.r_, a.i_ - b.i_};
+}
+
+template <typename T, typename E, rounding R>
+constexpr auto operator*(complex<dpp<T, E, R>> const& a,
+  complex<dpp<T, E, R>> const& b) noexcept
+{ // each component is rounded once
+  using D = dpp<T, E, R>;
+
+  using namespace detail;
+
+  if (isnan(a) || isnan(b)) [[unlikely]] return complex<D>(nan, nan);
+
+  return complex<D>(
+    sum<D, T, E, R>(term(a.r_, b.r_), neg(term(a.i_, b.i_))),
+    sum<D, T, E, R>(term(a.r_, b.i_), term(a.i_, b.r_))
+  );
+}
+
+template <typename T, typename E, rounding R>
+constexpr auto operator/(complex<dpp<T, E, R>> const& a,
+  complex<dpp<T, E, R>> const& b) noexcept
+{ // a * conj(b) / |b|^2, the numerator and |b|^2 are rounded once each
+  using D = dpp<T, E, R>;
+
+  using namespace detail;
+
+  if (isnan(a) || isnan(b)) [[unlikely]] return complex<D>(nan, nan);
+
+  auto const d(sum<D, T, E, R>(term(b.r_, b.r_), term(b.i_, b.i_)));
+
+  return complex<D>(
+    sum<D, T, E, R>(term(a.r_, b.r_), term(a.i_, b.i_)) / d,
+    sum<D, T, E, R>(term(a.i_, b.r_), neg(term(a.r_, b.i_))) / d
+  );
+}
+
+// real operands
+template <typename D>
+constexpr complex<D> operator+(complex<D> const& a, D const& b) noexcept
+{
+  return {a.r_ + b, a.i_};
+}
+
+template <typename D>
+constexpr complex<D> operator+(D const& a, complex<D> const& b) noexcept
+{
+  return {a + b.r_, b.i_};
+}
+
+template <typename D>
+constexpr complex<D> operator-(complex<D> const& a, D const& b) noexcept
+{
+  return {a.r_ - b, a.i_};
+}
+
+template <typename D>
+constexpr complex<D> operator-(D const& a, complex<D> const& b) noexcept
+{
+  return {a - b.r_, -b.i_};
+}
+
+template <typename D>
+constexpr complex<D> operator*(complex<D> const& a, D const& b) noexcept
+{
+  return {a.r_ * b, a.i_ * b};
+}
+
+template <typename D>
+constexpr complex<D> operator*(D const& a, complex<D> const& b) noexcept
+{
+  return {a * b.r_, a * b.i_};
+}
+
+template <typename D>
+constexpr complex<D> operator/(complex<D> const& a, D const& b) noexcept
+{
+  return {a.r_ / b, a.i_ / b};
+}
+
+template <typename D>
+constexpr complex<D> operator/(D const& a, complex<D> const& b) noexcept
+{
+  return complex<D>(a) / b;
+}
+
+//
+template <typename T, typename E, rounding R>
+constexpr auto fma(complex<dpp<T, E, R>> const& a,
+  complex<dpp<T, E, R>> const& b, complex<dpp<T, E, R>> const& c) noexcept
+{ // a * b + c, each component is rounded once
+  using D = dpp<T, E, R>;
+
+  using namespace detail;
+
+  if (isnan(a) || isnan(b) || isnan(c)) [[unlikely]]
+    return complex<D>(nan, nan);
+
+  return complex<D>(
+    sum<D, T, E, R>(term(a.r_, b.r_), neg(term(a.i_, b.i_)), term(c.r_)),
+    sum<D, T, E, R>(term(a.r_, b.i_), term(a.i_, b.r_), term(c.i_))
+  );
+}
+
+template <typename T, typename E, rounding R>
+constexpr auto norm(complex<dpp<T, E, R>> const& a) noexcept
+{ // |a|^2, rounded once
+  using D = dpp<T, E, R>;
+
+  using namespace detail;
+
+  return isnan(a) ? D(nan) :
+    sum<D, T, E, R>(term(a.r_, a.r_), term(a.i_, a.i_));
+}
+
+template <typename D>
+constexpr D abs(complex<D> const& a) noexcept
+{
+  return hypot(a.r_, a.i_);
+}
+
+// the number of iterations of z = z * z + c while |z| <= 2, at most max_iter
+template <typename D>
+constexpr unsigned escape_time(complex<D> z, complex<D> const& c,
+  unsigned const max_iter) noexcept
+{
+  unsigned j{};
+
+  for (; (max_iter != j) && detail::escape_step(z, c); ++j);
+
+  return j;
+}
+
+// batches of points, the components in separate arrays (SoA); the mandelbrot
+// set starts from z = c, a julia set from the points with a constant c
+template <typename D>
+constexpr void mandelbrot(D const* const cr, D const* const ci,
+  unsigned* const j, std::size_t const n, unsigned const max_iter) noexcept
+{
+  detail::escape_time<8, D>(n, j, max_iter,
+    [&](std::size_t const i) noexcept
+    {
+      complex<D> const c(cr[i], ci[i]);
+
+      return std::pair(c, c);
+    }
+  );
+}
+
+template <typename D>
+constexpr void julia(D const* const zr, D const* const zi,
+  complex<D> const& c, unsigned* const j, std::size_t const n,
+  unsigned const max_iter) noexcept
+{
+  detail::escape_time<8, D>(n, j, max_iter,
+    [&](std::size_t const i) noexcept
+    {
+      return std::pair(complex<D>(zr[i], zi[i]), c);
+    }
+  );
+}
+
+//
+template <typename D>
+std::ostream& operator<<(std::ostream& os, complex<D> const& a)
+{
+  return os << '(' << a.r_ << ',' << a.i_ << ')';
+}
+
+}
+
+#endif // DPP_COMPLEX_HPP
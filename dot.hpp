@@ -0,0 +1,330 @@
+#ifndef DPP_DOT_HPP
+# define DPP_DOT_HPP
+# pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+#include "dpp.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+// the products of two significands are exact in sig2_t; a sum of such
+// terms is rounded only once
+template <typename T, typename E, rounding R>
+constexpr auto term(dpp<T, E, R> const& a) noexcept
+{
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  return std::pair(U(a.m_), F(a.e_));
+}
+
+template <typename T, typename E, rounding R>
+constexpr auto term(dpp<T, E, R> const& a, dpp<T, E, R> const& b) noexcept
+{
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  return std::pair(U(a.m_) * U(b.m_), F(F(a.e_) + F(b.e_)));
+}
+
+constexpr auto neg(auto const& p) noexcept
+{
+  return std::pair(decltype(p.first)(-p.first), p.second);
+}
+
+template <typename U>
+inline constexpr auto pow10_v{
+  []() noexcept
+  {
+    std::array<U, maxpow10e<U>() + 1> p{U(1)};
+
+    for (std::size_t i(1); p.size() != i; ++i) p[i] = U(10) * p[i - 1];
+
+    return p;
+  }()
+};
+
+template <typename U>
+constexpr int digits10(U const m) noexcept
+{ // decimal digits of |m|, 0 for 0
+  auto const a(intt::is_neg(m) ? U(-m) : m);
+
+  int w; // bit width of a
+
+  if constexpr(std::is_integral_v<U>)
+    w = std::bit_width(std::make_unsigned_t<U>(a));
+  else if constexpr(!intt::is_intt_v<U>) // __int128
+  {
+    auto const h(std::uint64_t(a >> 64));
+
+    w = h ? 64 + std::bit_width(h) : std::bit_width(std::uint64_t(a));
+  }
+  else
+    return std::upper_bound(pow10_v<U>.begin(), pow10_v<U>.end(), a) -
+      pow10_v<U>.begin();
+
+  auto const t((w * 1233) >> 12); // floor(w * log10(2))
+
+  return t + 1 - (a < pow10_v<U>[t]);
+}
+
+template <typename U>
+constexpr auto fdiv10(U const m, std::size_t const d) noexcept
+{ // m = q * 10^d + r, 0 <= r < 10^d
+  auto const f(pow10_v<U>[d]);
+
+  U q;
+
+  if constexpr(std::is_integral_v<U> ||
+    (std::is_same_v<U, DPP_INT128T> && !intt::is_intt_v<U>))
+    q = m / f; // d differs term by term, one division beats the chunks
+  else
+  {
+    q = m;
+
+    [&]<auto ...I>(std::index_sequence<I...>) noexcept
+    { // q /= 10^d, a constant divisor at a time
+      (
+        [&]() noexcept
+        {
+          constexpr auto e0(
+            ar::coeff<pow(std::size_t(2), maxpow2e<U>() - I)>());
+
+          if (d & e0) q /= ar::coeff<pow(U(10), e0)>();
+        }(), ...
+      );
+    }(std::make_index_sequence<maxpow2e<U>() + 1>());
+  }
+
+  auto r(m - q * f);
+
+  if (intt::is_neg(r)) q -= U(1), r += f;
+
+  return std::pair(q, r);
+}
+
+template <typename U, typename F>
+constexpr U cut(U const m, F const e, F const b, bool& x) noexcept
+{ // floor(m * 10^(e - b)), x is set if nonzero digits were cut off
+  if (e >= b)
+    return m * pow10_v<U>[e - b];
+  else if (auto const d(b - e); d <= F(maxpow10e<U>()))
+  {
+    auto const [q, r](fdiv10(m, d));
+
+    x |= bool(r);
+
+    return q;
+  }
+  else
+  {
+    x |= bool(m);
+
+    return intt::is_neg(m) ? U(-1) : U{};
+  }
+}
+
+template <typename U, typename F>
+constexpr U band(U const m, F const e, F const b1, F const b2, bool& x)
+  noexcept
+{ // the digits of m * 10^e from 10^b2 up to 10^b1, of the part in
+  // [0, 10^b1), that is left after cut() at b1
+  if (e >= b1)
+    return {};
+  else if (auto const d(b1 - e); d <= F(maxpow10e<U>()))
+    return cut(fdiv10(m, d).second, e, b2, x);
+  else // |m| * 10^e < 10^b1
+    return intt::is_neg(m) ?
+      U(pow10_v<U>[b1 - b2] + cut(m, e, b2, x)) :
+      cut(m, e, b2, x);
+}
+
+template <typename D, typename U>
+inline constexpr auto sum_digits_v( // 10^sum_digits_v > the number of terms
+  maxpow10e<U>() - digits10(U(D::mmax)) - 4);
+
+template <typename D, typename U, std::size_t N = 0>
+constexpr D round_sum(std::size_t const n0, auto const t) noexcept
+{ // t(0) + ... + t(n - 1), each a pair (m, e) of m * 10^e, rounded once
+  //
+  // the terms are cut at 10^b, below the largest one by as many digits as U
+  // holds; the cut-off parts add up to [0, n) * 10^b. Only if a rounding
+  // boundary may lie in between, or if the sum cancelled to too few digits,
+  // are the digits below 10^b summed as well, band by band
+  using F = typename D::exp2_t;
+
+  auto const n(N ? N : n0); // N, if known at compile time
+
+  constexpr int W(maxpow10e<U>());
+  constexpr int P(digits10(U(D::mmax)));
+
+  auto const g(digits10(U(n)) + 1); // 10^g > 10 * n, M below is rare
+
+  auto const refine([&](U& c, F& b, bool& x) noexcept
+    { // c * 10^b + the parts below 10^b, rewritten for a lower b
+      auto const b2(b - F(W - 1 - digits10(U((intt::is_neg(c) ? -c : c) +
+        U(n)))));
+
+      c *= pow10_v<U>[b - b2]; x = {};
+
+      for (std::size_t i{}; n != i; ++i)
+      {
+        auto const [m, e](t(i));
+
+        c += band(U(m), F(e), b, b2, x);
+      }
+
+      b = b2;
+    }
+  );
+
+  // 10^b bounds the largest term, 10^e0 divides every term
+  F b(ar::coeff<std::numeric_limits<F>::min()>()),
+    e0(ar::coeff<std::numeric_limits<F>::max()>());
+
+  for (std::size_t i{}; n != i; ++i)
+    if (auto const [m, e](t(i)); m)
+      b = std::max(b, F(F(e) + F(digits10(U(m))))), e0 = std::min(e0, F(e));
+
+  if (ar::coeff<std::numeric_limits<F>::min()>() == b) [[unlikely]]
+    return U{};
+
+  b = std::max(F(b - F(W - 1 - g)), e0); // short terms are not cut at all
+
+  U m{};
+  bool x{};
+
+  for (std::size_t i{}; n != i; ++i)
+  {
+    if (auto const [mi, ei](t(i)); mi) m += cut(U(mi), F(ei), b, x);
+  }
+
+  // the sum is in (m, m + n) * 10^b, unless exact, once m has g + 1 more
+  // digits than sig_t, all rounding boundaries are multiples of 10^g
+  auto const l(U(2) * pow10_v<U>[P + g]);
+
+  if (constexpr auto h(pow10_v<U>[W - 2]);
+    x && (((m > l) && (m < h)) || ((m < -l) && (m > -h))))
+  { // no rounding boundary in between, if both ends round alike
+    D const lo(U(10) * m + U(1), b - 1), hi(U(10) * (m + U(n - 1)) + U(1),
+      b - 1);
+
+    if ((lo.m_ == hi.m_) && (lo.e_ == hi.e_)) [[likely]] return lo;
+  }
+
+  for (;; refine(m, b, x))
+    if (!x) // no trailing zeros, normalize() keeps more digits near mmax
+      return b < e0 ? D(U(m / pow10_v<U>[e0 - b]), e0) : D(m, b);
+    else if ((m > l) || (m < -l))
+      break;
+
+  // the sum has digits10(m) - 1 digits at least, the boundaries are
+  // multiples of 10^k, the more digits m has, the rarer is M below
+  auto const k(std::max(g, digits10(m) - P - 2));
+  auto const r(fdiv10(m, k).second);
+
+  if (auto const M(m - r + pow10_v<U>[k]); M < m + U(n))
+  { // a multiple of 10^k in (m, m + n), the sign of the sum - M decides
+    auto c(m - M);
+    auto b1(b);
+    auto x1(x);
+
+    for (; intt::is_neg(c) && x1 && (c > -U(n)); refine(c, b1, x1));
+
+    return {intt::is_neg(c) ? M - U(1) : c || x1 ? M + U(1) : M, b};
+  }
+  else
+  {
+    return {r ? m : m + U(1), b};
+  }
+}
+
+template <typename D, typename T, typename E, rounding R>
+constexpr D sum(auto const& p, auto const& q) noexcept
+{ // p + q, the term with the lower exponent is cut at most
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  constexpr int W(maxpow10e<U>());
+  constexpr int P(digits10(U(D::mmax)));
+
+  auto [ma, ea](p.second < q.second ? q : p); // ea >= eb
+  auto const [mb, eb](p.second < q.second ? p : q);
+
+  if (constexpr auto h(ar::coeff<U(max_v<U> / 2)>());
+    (ma >= -h) && (ma <= h) && (mb >= -h) && (mb <= h)) [[likely]]
+  { // the sum fits
+    if (auto const k(std::min(F(ea - eb), F(W - 2 - digits10(ma)))); k > 0)
+      ma *= pow10_v<U>[k], ea -= k;
+
+    if (ea == eb) return D(U(ma + mb), ea);
+
+    if (auto const d(ea - eb); d <= F(W))
+    { // the sum is in [s, s + 1)
+      auto const [c, r](fdiv10(U(mb), d));
+
+      if (auto const s(ma + c); !r)
+        return D(s, ea);
+      else if (constexpr auto l(pow10_v<U>[P + 2]); (s > l) || (s < -l))
+        return D(s % U(10) ? s : U(s + U(1)), ea); // a sticky digit
+    }
+  }
+
+  std::array const a{p, q};
+
+  return round_sum<D, U, 2>({},
+    [&](std::size_t const i) noexcept -> auto& { return a[i]; });
+}
+
+template <typename D, typename T, typename E, rounding R>
+constexpr D sum(auto const& ...p) noexcept
+{ // p..., rounded once
+  std::array const a{p...};
+
+  return round_sum<D, typename D::sig2_t, sizeof...(p)>({},
+    [&](std::size_t const i) noexcept -> auto& { return a[i]; });
+}
+
+template <std::size_t N, typename T, typename E, rounding R>
+constexpr dpp<T, E, R> dot(dpp<T, E, R> const* const a,
+  dpp<T, E, R> const* const b, std::size_t const n) noexcept
+{ // N = n, if known at compile time, or 0
+  using D = dpp<T, E, R>;
+  using U = typename D::sig2_t;
+
+  for (std::size_t i{}; n != i; ++i)
+    if (isnan(a[i]) || isnan(b[i])) [[unlikely]] return nan;
+
+  auto const t([&](std::size_t const i) noexcept { return term(a[i], b[i]); });
+
+  if constexpr(std::is_void_v<double_t<U>> ||
+    (sum_digits_v<D, U> > std::numeric_limits<std::size_t>::digits10))
+    return round_sum<D, U, N>(n, t);
+  else
+    return U(n) < pow10_v<U>[sum_digits_v<D, U>] ?
+      round_sum<D, U, N>(n, t) :
+      round_sum<D, double_t<U>, N>(n, t);
+}
+
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> dot(dpp<T, E, R> const* const a,
+  dpp<T, E, R> const* const b, std::size_t const n) noexcept
+{ // a[0] * b[0] + ... + a[n - 1] * b[n - 1], rounded once; on d64 n must
+  // stay below 10^16
+  return detail::dot<0>(a, b, n);
+}
+
+}
+
+#endif // DPP_DOT_HPP
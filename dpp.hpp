@@ -3,6 +3,7 @@
 # pragma once
 
 #include <float.h>
+#include <charconv> // to_chars_result
 #include <limits> // quiet_NaN()
 #include "intt/intt.hpp"
 
@@ -21,6 +22,8 @@ inline constexpr direct_t direct{};
 struct nan_t { explicit nan_t() = default; };
 inline constexpr nan_t nan{};
 
+enum class rounding { half_even, half_up, half_down, toward_zero, floor, ceil };
+
 namespace detail
 {
 
@@ -132,6 +135,144 @@ constexpr void slash_zeros(auto& m, auto& e) noexcept
 }
 
 template <typename T>
+constexpr void widen(auto& m, auto& e) noexcept
+{ // m *= 10^k, e -= k, as long as m fits, the dividend of a division
+  using U = std::remove_reference_t<decltype(m)>;
+  using F = std::remove_reference_t<decltype(e)>;
+
+  if (intt::is_neg(m))
+    //for (; m > ar::coeff<detail::min_v<U> / 10>(); m *= U(10), --e);
+    (
+      [&]<auto ...I>(std::index_sequence<I...>) noexcept
+      {
+        (
+          [&]() noexcept -> bool
+          {
+            constexpr auto e0(ar::coeff<pow(F(2), maxpow2e<T>() - I)>());
+            constexpr auto f(ar::coeff<pow(U(10), e0)>());
+
+            if (m >= ar::coeff<min_v<U> / f>()) e -= e0, m *= f;
+
+            return m > ar::coeff<U(min_v<U> / 10)>();
+          }() && ...
+        );
+      }(std::make_index_sequence<maxpow2e<T>() + 1>())
+    );
+  else
+    //for (; m < ar::coeff<detail::max_v<U> / 10>(); m *= U(10), --e);
+    [&]<auto ...I>(std::index_sequence<I...>) noexcept
+    {
+      (
+        [&]() noexcept -> bool
+        {
+          constexpr auto e0(ar::coeff<pow(F(2), maxpow2e<T>() - I)>());
+          constexpr auto f(ar::coeff<pow(U(10), e0)>());
+
+          if (m <= ar::coeff<max_v<U> / f>()) e -= e0, m *= f;
+
+          return m < ar::coeff<U(max_v<U> / 10)>();
+        }() && ...
+      );
+    }(std::make_index_sequence<maxpow2e<T>() + 1>());
+}
+
+template <rounding R>
+constexpr auto round10(auto const m, [[maybe_unused]] bool const x) noexcept
+{ // m / 10, rounded, x is set if digits below m were cut off
+  using U = std::remove_cv_t<decltype(m)>;
+
+  if constexpr(rounding::half_up == R)
+    return intt::is_neg(m) ? (m - U(5)) / U(10) : (m + U(5)) / U(10);
+  else if constexpr(rounding::toward_zero == R)
+    return m / U(10);
+  else
+  {
+    auto const neg(intt::is_neg(m));
+    auto const q(m / U(10));
+    auto const g(neg ? q * U(10) - m : m - q * U(10));
+
+    bool up;
+
+    if constexpr(rounding::half_even == R)
+      up = (g > U(5)) || ((U(5) == g) && (x || (q % U(2))));
+    else if constexpr(rounding::half_down == R)
+      up = (g > U(5)) || ((U(5) == g) && x);
+    else if constexpr(rounding::floor == R)
+      up = neg && (g || x);
+    else
+      up = !neg && (g || x);
+
+    return up ? neg ? q - U(1) : q + U(1) : q;
+  }
+}
+
+template <rounding R>
+inline constexpr bool half_v((rounding::half_even == R) ||
+  (rounding::half_up == R) || (rounding::half_down == R));
+
+template <rounding R>
+consteval auto fit10_max(auto const M) noexcept
+{ // the largest |m / 10| fit10() takes, the half modes need a guard digit up
+  // to the multiple of 10 above M, the next representable value
+  using U = decltype(M);
+
+  if constexpr(half_v<R>) return U(10) * ((M + U(10)) / U(10)) - U(1);
+  else return M;
+}
+
+template <rounding R>
+constexpr auto fit10(auto const m, decltype(m) M, bool const x, auto& e)
+  noexcept
+{ // m rounded to fit M = 2^k - 1, M < |m| <= 10 * fit10_max<R>(M) + 9; past
+  // M, up to C, the multiple of 10 above it, nothing is representable, the
+  // half modes round to the nearer of M and C, a tie goes to C for half_up,
+  // to M otherwise
+  using U = std::remove_cv_t<decltype(m)>;
+
+  auto const neg(intt::is_neg(m));
+  auto const a(neg ? U(-m) : m);
+  auto const C(U(10) * ((M + U(10)) / U(10)));
+
+  auto const up([&](U const d) noexcept
+    { // d: 2 * a - M - C, scaled, relative to the middle of M and C
+      if constexpr(half_v<R>)
+        return (d > U{}) || (!d && (x || (rounding::half_up == R)));
+      else if constexpr(rounding::floor == R)
+        return neg;
+      else if constexpr(rounding::ceil == R)
+        return !neg;
+      else
+        return false;
+    }
+  );
+
+  if (a < C) // M or C at the same place
+    return up(U(2) * a - M - C) ? (++e, neg ? U(-C / U(10)) : U(C / U(10))) :
+      neg ? U(-M) : M;
+  else if (auto const r(round10<R>(m, x)); neg ? r >= -M : r <= M)
+    return ++e, r;
+  else if constexpr(half_v<R>) // M or C a place further
+    return up(a - U(5) * (M + C)) ? (e += 2, neg ? U(-C / U(10)) :
+      U(C / U(10))) : (++e, neg ? U(-M) : M);
+  else
+    return e += 2, round10<R>(m / U(10), x || bool(m % U(10)));
+}
+
+template <rounding R>
+constexpr void jam(auto& m, auto& e) noexcept
+{ // appends a nonzero digit to a truncated m, a sticky digit
+  using U = std::remove_reference_t<decltype(m)>;
+
+  auto const neg(intt::is_neg(m));
+
+  if (neg ? m > ar::coeff<U(min_v<U> / 10)>() :
+    m < ar::coeff<U(max_v<U> / 10)>())
+    --e, m = U(10) * m + (neg ? U(-1) : U(1));
+  else if (!(m % U(10)))
+    neg ? --m : ++m;
+}
+
+template <typename T, rounding R = rounding::half_up>
 constexpr void align(auto& ma, auto& ea, decltype(ma) mb,
   std::remove_reference_t<decltype(ea)> i) noexcept
 {
@@ -176,24 +317,37 @@ constexpr void align(auto& ma, auto& ea, decltype(ma) mb,
     }(std::make_index_sequence<maxpow2e<U>() + 1>());
 
   if (i)
+  {
+    auto const neg(intt::is_neg(mb));
+    bool x{};
+
     [&]<auto ...I>(std::index_sequence<I...>) noexcept
     {
       (
         [&]() noexcept -> bool
         {
           constexpr auto e(ar::coeff<pow(F(2), maxpow2e<T>() - I)>());
+          constexpr auto f(ar::coeff<pow(U(10), e)>());
 
-          if (e <= i) i -= e, mb /= ar::coeff<pow(U(10), e)>();
+          if (e <= i)
+          {
+            x = x || bool(mb % f);
+            i -= e, mb /= f;
+          }
 
           return i && mb;
         }() && ...
       );
     }(std::make_index_sequence<maxpow2e<T>() + 1>());
+
+    // ma was widened, there are plenty of digits below the rounding digit
+    if ((x = x || (i && mb)) && !(mb % U(10))) neg ? --mb : ++mb;
+  }
 }
 
 }
 
-template <typename T, typename E>
+template <typename T, typename E, rounding R = rounding::half_up>
   requires(detail::is_signed_v<T> && detail::is_signed_v<E>)
 struct dpp
 {
@@ -226,55 +380,68 @@ struct dpp
   dpp(dpp const&) = default;
   dpp(dpp&&) = default;
 
-  constexpr dpp(sig2_t m, exp2_t e = {}) noexcept
-  {
+  static constexpr void normalize(sig2_t& m, exp2_t& e) noexcept
+  { // rounds m to fit sig_t, e is not range checked
     using U = sig2_t;
     using F = exp2_t;
 
     using namespace detail;
 
+    // |m| > 10 * L + 9 needs more digits cut
+    constexpr auto L(ar::coeff<fit10_max<R>(U(mmax))>());
+
+    bool x{}; // sticky
+
     if (m < ar::coeff<U(mmin)>())
-    { //for (++e; m < ar::coeff<U(10 * U(mmin) + 5)>(); ++e, m /= 10);
+    { //for (; m < ar::coeff<U(-10 * L - U(9))>(); ++e, m /= 10);
       [&]<auto ...I>(std::index_sequence<I...>) noexcept
       {
         (
           [&]() noexcept
           {
-            constexpr auto J(ar::coeff<maxpow2e2<U, T>() - I>());
-            constexpr auto e0(ar::coeff<pow(F(2), J)>());
+            constexpr auto e0(ar::coeff<pow(F(2), maxpow2e2<U, T>() - I)>());
             constexpr auto f(ar::coeff<pow(U(10), e0)>());
-            constexpr auto cmp(ar::coeff<U(mmin) * f + (J ? 0 : 5)>());
+            constexpr auto cmp(ar::coeff<U(-L - U(1)) * f + U(1)>());
 
-            if (m < cmp) e += e0, m /= f;
+            if (m < cmp) x = x || bool(m % f), e += e0, m /= f;
 
-            return m < ar::coeff<U(10 * U(mmin) + 5)>();
+            return m < ar::coeff<U(-10 * L - U(9))>();
           }() && ...
         );
       }(std::make_index_sequence<maxpow2e2<U, T>() + 1>());
 
-      ++e; m = (m - U(5)) / U(10);
+      m = fit10<R>(m, U(mmax), x, e);
     }
     else if (m > ar::coeff<U(mmax)>())
-    { //for (++e; m > ar::coeff<U(10 * U(mmax) - 5)>(); ++e, m /= 10);
+    { //for (; m > ar::coeff<U(10 * L + U(9))>(); ++e, m /= 10);
       [&]<auto ...I>(std::index_sequence<I...>) noexcept
       {
         (
           [&]() noexcept -> bool
           {
-            constexpr auto J(ar::coeff<maxpow2e2<U, T>() - I>());
-            constexpr auto e0(ar::coeff<pow(F(2), J)>());
+            constexpr auto e0(ar::coeff<pow(F(2), maxpow2e2<U, T>() - I)>());
             constexpr auto f(ar::coeff<pow(U(10), e0)>());
-            constexpr auto cmp(ar::coeff<U(mmax) * f - (J ? 0 : 5)>());
+            constexpr auto cmp(ar::coeff<U(L + U(1)) * f - U(1)>());
 
-            if (m > cmp) e += e0, m /= f;
+            if (m > cmp) x = x || bool(m % f), e += e0, m /= f;
 
-            return m > ar::coeff<U(10 * U(mmax) - 5)>();
+            return m > ar::coeff<U(10 * L + U(9))>();
           }() && ...
         );
       }(std::make_index_sequence<maxpow2e2<U, T>() + 1>());
 
-      ++e; m = (m + U(5)) / U(10);
+      m = fit10<R>(m, U(mmax), x, e);
     }
+  }
+
+  constexpr dpp(sig2_t m, exp2_t e = {}) noexcept
+  {
+    using U = sig2_t;
+    using F = exp2_t;
+
+    using namespace detail;
+
+    normalize(m, e);
 
     //
     if (e <= ar::coeff<F(emax)>()) [[likely]]
@@ -305,30 +472,39 @@ struct dpp
   template <detail::integral U>
   constexpr dpp(U m, exp2_t e = {}) noexcept
   { // we need extra bits, hence exp2_t
+    [[maybe_unused]] bool x{}; // sticky
+
     if constexpr(detail::is_signed_v<U> &&
       (ar::bit_size_v<U> > ar::bit_size_v<T>))
     {
+      constexpr auto L(ar::coeff<detail::fit10_max<R>(U(mmax))>());
+
       if (m < ar::coeff<U(mmin)>())
       {
-        for (++e; m < ar::coeff<U(10 * U(mmin) + 5)>(); ++e, m /= 10);
+        for (; m / 10 < -L; ++e, m /= 10)
+          x = x || bool(m % 10);
 
-        m = (m - U(5)) / U(10);
+        m = detail::fit10<R>(m, U(mmax), x, e);
       }
       else if (m > ar::coeff<U(mmax)>())
       {
-        for (++e; m > ar::coeff<U(10 * U(mmax) - 5)>(); ++e, m /= 10);
+        for (; m / 10 > L; ++e, m /= 10)
+          x = x || bool(m % 10);
 
-        m = (m + U(5)) / U(10);
+        m = detail::fit10<R>(m, U(mmax), x, e);
       }
     }
     else if constexpr(std::is_unsigned_v<U> &&
       (ar::bit_size_v<U> >= ar::bit_size_v<T>))
     {
+      constexpr auto L(ar::coeff<detail::fit10_max<R>(U(mmax))>());
+
       if (m > ar::coeff<U(mmax)>())
       {
-        for (++e; m > ar::coeff<U(10 * U(mmax) - 5)>(); ++e, m /= 10);
+        for (; m / 10 > L; ++e, m /= 10)
+          x = x || bool(m % 10);
 
-        m = (m + U(5)) / U(10);
+        m = detail::fit10<R>(m, U(mmax), x, e);
       }
     }
 
@@ -369,8 +545,8 @@ struct dpp
     *this = dpp(T(std::round(std::ldexp(e10 <= 0 ? a * k : a / k, e2))), e10);
   }
 
-  template <typename U, typename V>
-  constexpr dpp(dpp<U, V> const& o) noexcept
+  template <typename U, typename V, rounding S>
+  constexpr dpp(dpp<U, V, S> const& o) noexcept
   {
     *this = isnan(o) ? nan : dpp(o.sig(), o.exp());
   }
@@ -514,8 +690,8 @@ struct dpp
     exp2_t ea(e_), eb(o.e_);\
 \
     return e_ < o.e_ ?\
-      (detail::align<T>(mb, eb, ma, eb - ea), dpp(ma OP mb, eb)) :\
-      (detail::align<T>(ma, ea, mb, ea - eb), dpp(ma OP mb, ea));\
+      (detail::align<T, R>(mb, eb, ma, eb - ea), dpp(ma OP mb, eb)) :\
+      (detail::align<T, R>(ma, ea, mb, ea - eb), dpp(ma OP mb, ea));\
   }
 
   DPP_OPERATOR_PM__(+)
@@ -532,6 +708,15 @@ struct dpp
     if (isnan(*this) || isnan(o) || !o.m_) [[unlikely]] return nan;
     else if (!m_) [[unlikely]] return {};
 
+    exp2_t e;
+    auto const m(quotient(*this, o, e));
+
+    return dpp(m, e);
+  }
+
+  static constexpr sig2_t quotient(dpp const& a, dpp const& b, exp2_t& e)
+    noexcept
+  { // a / b, neither is 0 or nan, the quotient is unrounded
     using U = sig2_t;
     using F = exp2_t;
 
@@ -539,45 +724,31 @@ struct dpp
 
     constexpr F e0(ar::coeff<maxpow10e<T, F>()>());
 
-    F e(F(e_) - F(o.e_) - e0);
-    U m(ar::coeff<pow(U(10), e0)>() * U(m_));
+    e = F(a.e_) - F(b.e_) - e0;
+    U m(ar::coeff<pow(U(10), e0)>() * U(a.m_));
 
-    if (intt::is_neg(m))
-      //for (; m > ar::coeff<detail::min_v<U> / 10>(); m *= U(10), --e);
-      (
-        [&]<auto ...I>(std::index_sequence<I...>) noexcept
-        {
-          (
-            [&]() noexcept -> bool
-            {
-              constexpr F e0(ar::coeff<pow(F(2), maxpow2e<T>() - I)>());
-              constexpr U f(ar::coeff<pow(U(10), e0)>());
+    widen<T>(m, e);
 
-              if (m >= ar::coeff<min_v<U> / f>()) e -= e0, m *= f;
+    if constexpr(rounding::toward_zero != R)
+    { // a guard digit and a sticky digit, truncation needs neither
+      U const d(b.m_);
+      U q(m / d), r(m - q * d);
 
-              return m > ar::coeff<U(min_v<U> / 10)>();
-            }() && ...
-          );
-        }(std::make_index_sequence<maxpow2e<T>() + 1>())
-      );
-    else
-      //for (; m < ar::coeff<detail::max_v<U> / 10>(); m *= U(10), --e);
-      [&]<auto ...I>(std::index_sequence<I...>) noexcept
+      for (; (q >= ar::coeff<U(10 * U(mmin))>()) &&
+        (q <= ar::coeff<U(10 * U(mmax))>()); --e)
       {
-        (
-          [&]() noexcept -> bool
-          {
-            constexpr F e0(ar::coeff<pow(F(2), maxpow2e<T>() - I)>());
-            constexpr U f(ar::coeff<pow(U(10), e0)>());
+        auto const t(U(10) * r / d);
 
-            if (m <= ar::coeff<max_v<U> / f>()) e -= e0, m *= f;
+        q = U(10) * q + t;
+        r = U(10) * r - t * d;
+      }
 
-            return m < ar::coeff<U(max_v<U> / 10)>();
-          }() && ...
-        );
-      }(std::make_index_sequence<maxpow2e<T>() + 1>());
+      if (r) jam<R>(q, e);
 
-    return dpp(m / sig2_t(o.m_), e);
+      return q;
+    }
+    else
+      return m / U(b.m_);
   }
 
   //
@@ -617,15 +788,31 @@ using d32 = dpp<std::int32_t, std::int16_t>;
 using d24 = dpp<intt::intt<std::uint8_t, 3>, std::int8_t>;
 using d16 = dpp<std::int16_t, std::int8_t>;
 
+namespace detail
+{
+
+template <typename D, rounding> struct rounded;
+
+template <typename T, typename E, rounding R, rounding S>
+struct rounded<dpp<T, E, R>, S> { using type = dpp<T, E, S>; };
+
+}
+
+// e.g. rounded_t<d64, rounding::half_even>
+template <typename D, rounding R>
+using rounded_t = typename detail::rounded<D, R>::type;
+
 // type promotions
 #define DPP_TYPE_PROMOTION__(OP)\
-template <typename A, typename B, typename C, typename D>\
-constexpr auto operator OP (dpp<A, B> const& a, dpp<C, D> const& b) noexcept\
+template <typename A, typename B, rounding RA,\
+  typename C, typename D, rounding RB>\
+constexpr auto operator OP (dpp<A, B, RA> const& a,\
+  dpp<C, D, RB> const& b) noexcept\
 {\
   if constexpr(ar::bit_size_v<A> < ar::bit_size_v<C>)\
-    return dpp<C, D>(a) OP b;\
+    return dpp<C, D, RB>(a) OP b;\
   else\
-    return a OP dpp<A, B>(b);\
+    return a OP dpp<A, B, RA>(b);\
 }
 
 DPP_TYPE_PROMOTION__(+)
@@ -635,31 +822,33 @@ DPP_TYPE_PROMOTION__(/)
 DPP_TYPE_PROMOTION__(<=>)
 
 // comparisons
-template <typename A, typename B>
-constexpr bool operator==(dpp<A, B> const& a, nan_t) noexcept
+template <typename A, typename B, rounding R>
+constexpr bool operator==(dpp<A, B, R> const& a, nan_t) noexcept
 {
   return isnan(a);
 }
 
-template <typename A, typename B>
-constexpr bool operator==(nan_t, dpp<A, B> const& a) noexcept
+template <typename A, typename B, rounding R>
+constexpr bool operator==(nan_t, dpp<A, B, R> const& a) noexcept
 {
   return isnan(a);
 }
 
-template <typename A, typename B, typename C, typename D>
-constexpr bool operator==(dpp<A, B> const& a, dpp<C, D> const& b) noexcept
+template <typename A, typename B, rounding RA,
+  typename C, typename D, rounding RB>
+constexpr bool operator==(dpp<A, B, RA> const& a,
+  dpp<C, D, RB> const& b) noexcept
 {
   return a <=> b == 0;
 }
 
 // conversions
 #define DPP_LEFT_CONVERSION__(OP)\
-template <typename A, typename B>\
+template <typename A, typename B, rounding R>\
 constexpr auto operator OP (detail::arithmetic auto const a,\
-  dpp<A, B> const& b) noexcept\
+  dpp<A, B, R> const& b) noexcept\
 {\
-  return dpp<A, B>(a) OP b;\
+  return dpp<A, B, R>(a) OP b;\
 }
 
 DPP_LEFT_CONVERSION__(+)
@@ -675,11 +864,11 @@ DPP_LEFT_CONVERSION__(>=)
 DPP_LEFT_CONVERSION__(<=>)
 
 #define DPP_RIGHT_CONVERSION__(OP)\
-template <typename A, typename B>\
-constexpr auto operator OP (dpp<A, B> const& a,\
+template <typename A, typename B, rounding R>\
+constexpr auto operator OP (dpp<A, B, R> const& a,\
   detail::arithmetic auto const b) noexcept\
 {\
-  return a OP dpp<A, B>(b);\
+  return a OP dpp<A, B, R>(b);\
 }
 
 DPP_RIGHT_CONVERSION__(+)
@@ -695,66 +884,132 @@ DPP_RIGHT_CONVERSION__(>=)
 DPP_RIGHT_CONVERSION__(<=>)
 
 // utilities
-template <typename T, typename E>
-constexpr auto isnan(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr auto isnan(dpp<T, E, R> const& a) noexcept
 {
-  return ar::coeff<dpp<T, E>::emin>() == a.exp();
+  return ar::coeff<dpp<T, E, R>::emin>() == a.exp();
 }
 
 //
-template <typename T, typename E>
-constexpr auto abs(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr auto abs(dpp<T, E, R> const& a) noexcept
 {
   return intt::is_neg(a.sig()) ? -a : a;
 }
 
 //
-template <typename T, typename E>
-constexpr auto trunc(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr auto trunc(dpp<T, E, R> const& a) noexcept
 {
-  return !intt::is_neg(a.exp()) || isnan(a) ? a : dpp<T, E>(direct, T(a));
+  return !intt::is_neg(a.exp()) || isnan(a) ? a : dpp<T, E, R>(direct, T(a));
 }
 
-template <typename T, typename E>
-constexpr auto ceil(dpp<T, E> const& a) noexcept
-{
-  auto const t(trunc(a)); return t + (t < a);
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> quantize(dpp<T, E, R> const& a,
+  typename dpp<T, E, R>::exp2_t const e, rounding const r = R) noexcept
+{ // rounds to a multiple of 10^e, half_up rounds half away from zero
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  using namespace detail;
+
+  if (isnan(a)) [[unlikely]] return nan;
+  else if (F(a.e_) >= e) return a;
+
+  T q{};
+  bool x(a.m_); // inexact
+  int c(-1); // sign of |remainder| - 10^k / 2
+
+  auto const div([&](T const& f) noexcept
+    {
+      q = a.m_ / f;
+
+      auto const s(a.m_ - q * f);
+      auto const h(f / T(2));
+
+      x = bool(s);
+      c = intt::is_neg(s) ? (T(-s) > h) - (T(-s) < h) : (s > h) - (s < h);
+    }
+  );
+
+  if (auto const k(e - F(a.e_)); k <= F(maxpow10e<T>()))
+  {
+    if constexpr(std::is_integral_v<T>)
+      [&]<auto ...I>(std::index_sequence<I...>) noexcept
+      { // the divisor is a constant, no division
+        (
+          [&]() noexcept
+          {
+            return F(I + 1) == k ?
+              (div(ar::coeff<pow(T(10), I + 1)>()), true) :
+              false;
+          }() || ...
+        );
+      }(std::make_index_sequence<maxpow10e<T>()>());
+    else
+      div(pow(T(10), k));
+  }
+  else if (ar::coeff<F(maxpow10e<T>() + 1)>() == k)
+  { // q = 0, 10^k / 2 might still be exceeded, e.g. by int64_t
+    constexpr auto h(ar::coeff<U(5) * pow(U(10), maxpow10e<T>())>());
+    auto const s(intt::is_neg(a.m_) ? U(-U(a.m_)) : U(a.m_));
+
+    c = (s > h) - (s < h);
+  }
+
+  bool away{};
+
+  switch (r)
+  {
+    case rounding::half_even: away = (c > 0) || (!c && (q % T(2))); break;
+    case rounding::half_up: away = c >= 0; break;
+    case rounding::half_down: away = c > 0; break;
+    case rounding::toward_zero: break;
+    case rounding::floor: away = intt::is_neg(a.m_); break;
+    case rounding::ceil: away = !intt::is_neg(a.m_); break;
+  }
+
+  if (x && away) intt::is_neg(a.m_) ? --q : ++q;
+
+  return q ? dpp<T, E, R>(U(q), e) : dpp<T, E, R>{};
 }
 
-template <typename T, typename E>
-constexpr auto floor(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr auto ceil(dpp<T, E, R> const& a) noexcept
 {
-  auto const t(trunc(a)); return t - (t > a);
+  return quantize(a, {}, rounding::ceil);
 }
 
-template <typename T, typename E>
-constexpr auto round(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr auto floor(dpp<T, E, R> const& a) noexcept
 {
-  constexpr dpp<T, E> c(direct, T(5), E(-1));
+  return quantize(a, {}, rounding::floor);
+}
 
-  return intt::is_neg(a.exp()) ?
-    trunc(intt::is_neg(a.sig()) ? a - c : a + c) :
-    a;
+template <typename T, typename E, rounding R>
+constexpr auto round(dpp<T, E, R> const& a) noexcept
+{
+  return quantize(a, {}, rounding::half_up);
 }
 
 //
-template <typename T, typename E>
-constexpr dpp<T, E> inv(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> inv(dpp<T, E, R> const& a) noexcept
 { // multiplicative inverse or reciprocal
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
   constexpr auto e0{ar::coeff<F(-detail::maxpow10e<U, F>())>()};
 
   return isnan(a) || !a.m_ ? nan :
-    dpp<T, E>(ar::coeff<detail::pow(U(10), e0)>() / U(a.m_), e0 - F(a.e_));
+    dpp<T, E, R>(ar::coeff<detail::pow(U(10), e0)>() / U(a.m_), e0 - F(a.e_));
 }
 
-template <typename T, typename E>
-constexpr dpp<T, E> midpoint(dpp<T, E> const& a, dpp<T, E> const& b) noexcept
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> midpoint(dpp<T, E, R> const& a, dpp<T, E, R> const& b) noexcept
 {
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
   if (isnan(a) || isnan(b)) [[unlikely]] return nan;
 
@@ -762,18 +1017,18 @@ constexpr dpp<T, E> midpoint(dpp<T, E> const& a, dpp<T, E> const& b) noexcept
   F ea(a.e_), eb(b.e_);
 
   return a.e_ < b.e_ ?
-    (detail::align<T>(mb, eb, ma, eb - ea),
-    dpp<T, E>(U(5) * (ma + mb), eb - F(1))) :
-    (detail::align<T>(ma, ea, mb, ea - eb),
-    dpp<T, E>(U(5) * (ma + mb), ea - F(1)));
+    (detail::align<T, R>(mb, eb, ma, eb - ea),
+    dpp<T, E, R>(U(5) * (ma + mb), eb - F(1))) :
+    (detail::align<T, R>(ma, ea, mb, ea - eb),
+    dpp<T, E, R>(U(5) * (ma + mb), ea - F(1)));
 }
 
-template <typename T, typename E>
-constexpr dpp<T, E> fma(dpp<T, E> const& a, dpp<T, E> const& b,
-  dpp<T, E> const& c) noexcept
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> fma(dpp<T, E, R> const& a, dpp<T, E, R> const& b,
+  dpp<T, E, R> const& c) noexcept
 {
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
   if (isnan(a) || isnan(b) || isnan(c)) [[unlikely]] return nan;
 
@@ -781,9 +1036,9 @@ constexpr dpp<T, E> fma(dpp<T, E> const& a, dpp<T, E> const& b,
   F ea(F(a.e_) + F(b.e_)), eb(c.e_);
 
   return ea < eb ?
-    (detail::align<T>(mb <<= 1, eb, ma, eb - ea),
-    dpp<T, E>(ma + (mb >> 1), eb)) :
-    (detail::align<T>(ma, ea, mb, ea - eb), dpp<T, E>(ma + mb, ea));
+    (detail::align<T, R>(mb <<= 1, eb, ma, eb - ea),
+    dpp<T, E, R>(ma + (mb >> 1), eb)) :
+    (detail::align<T, R>(ma, ea, mb, ea - eb), dpp<T, E, R>(ma + mb, ea));
 }
 
 // conversions
@@ -860,10 +1115,10 @@ constexpr auto to_decimal(auto const& s) ->
   return to_decimal<T>(std::begin(s), std::end(s));
 }
 
-template <typename T, typename E>
-std::string to_string(dpp<T, E> const& a)
+template <typename T, typename E, rounding R>
+std::string to_string(dpp<T, E, R> const& a)
 {
-  using F = typename dpp<T, E>::exp2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
   if (isnan(a)) [[unlikely]] return {"nan", 3};
 
@@ -900,14 +1155,85 @@ std::string to_string(dpp<T, E> const& a)
   return r;
 }
 
-template <typename T, typename E>
-auto& operator<<(std::ostream& os, dpp<T, E> const& p)
+template <typename T, typename E, rounding R>
+std::to_chars_result to_chars(char* first, char* const last,
+  dpp<T, E, R> const& a) noexcept
+{ // the text of to_string(), without allocations
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  if (isnan(a)) [[unlikely]]
+  {
+    if (last - first < 3) return {last, std::errc::value_too_large};
+
+    *first++ = 'n'; *first++ = 'a'; *first++ = 'n';
+
+    return {first, {}};
+  }
+
+  auto m(a.sig());
+  F e;
+
+  if (m) [[likely]]
+  {
+    if (intt::is_neg(e = a.exp()))
+      detail::slash_zeros(m, e);
+  }
+  else [[unlikely]]
+    e = {};
+
+  // the digits of |m|, from the back, log10(2) < 1/3
+  char d[ar::bit_size_v<T> / 3 + 1];
+  auto p(std::end(d));
+
+  auto const neg(intt::is_neg(m));
+
+  do
+  {
+    auto const r(int(m % T(10)));
+
+    *--p = char('0' + (neg ? -r : r));
+  }
+  while (m /= T(10));
+
+  //
+  std::ptrdiff_t const n(std::end(d) - p);
+  auto const k(F(n) + e); // digits before the point, if e < 0
+
+  if (std::ptrdiff_t(neg) + n + (intt::is_neg(e) ?
+    (k > 0 ? 1 : 2 - std::ptrdiff_t(k)) : std::ptrdiff_t(e)) > last - first)
+    return {last, std::errc::value_too_large};
+
+  if (neg) *first++ = '-';
+
+  if (!intt::is_neg(e))
+  {
+    while (std::end(d) != p) *first++ = *p++;
+    for (; e; --e) *first++ = '0';
+  }
+  else if (k > 0)
+  {
+    for (auto const q(p + k); q != p;) *first++ = *p++;
+    *first++ = '.';
+    while (std::end(d) != p) *first++ = *p++;
+  }
+  else
+  {
+    *first++ = '0'; *first++ = '.';
+    for (auto i(k); i; ++i) *first++ = '0';
+    while (std::end(d) != p) *first++ = *p++;
+  }
+
+  return {first, {}};
+}
+
+template <typename T, typename E, rounding R>
+auto& operator<<(std::ostream& os, dpp<T, E, R> const& p)
 { // !!!
   return os << to_string(p);
 }
 
-template <typename T, typename E>
-auto& operator>>(std::istream& is, dpp<T, E>& p)
+template <typename T, typename E, rounding R>
+auto& operator>>(std::istream& is, dpp<T, E, R>& p)
 {
   if (std::istream::sentry s(is); s) [[likely]]
   {
@@ -921,7 +1247,7 @@ auto& operator>>(std::istream& is, dpp<T, E>& p)
       else
         is.setstate(std::ios::failbit);
     }
-    else if (nan == (p = to_decimal<dpp<T, E>>(i, end)))
+    else if (nan == (p = to_decimal<dpp<T, E, R>>(i, end)))
       is.setstate(std::ios::failbit);
     else
       while (end != i && std::isdigit((unsigned char)(*i))) ++i;
@@ -953,12 +1279,12 @@ DPP_LITERAL__(512) DPP_LITERAL__(1024)
 namespace std
 {
 
-template <typename T, typename E>
-struct hash<dpp::dpp<T, E>>
+template <typename T, typename E, dpp::rounding R>
+struct hash<dpp::dpp<T, E, R>>
 {
-  using F = typename dpp::dpp<T, E>::exp2_t;
+  using F = typename dpp::dpp<T, E, R>::exp2_t;
 
-  std::size_t operator()(dpp::dpp<T, E> const& a) const
+  std::size_t operator()(dpp::dpp<T, E, R> const& a) const
     noexcept(noexcept(std::hash<T>()(std::declval<T>()),
       std::hash<F>()(std::declval<F>())))
   {
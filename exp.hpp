@@ -0,0 +1,766 @@
+#ifndef DPP_EXP_HPP
+# define DPP_EXP_HPP
+# pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string_view>
+
+#include "numbers.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+inline constexpr char const* const exp8_digits[]{ // exp(j / 8), j = 1 .. 18
+    "1.13314845306682631682900722781179387256550313174518162591282003607882"
+    "3577880048386513939990794941728573231527015647307565704821045258473399"
+    "8785564025916995261162759280700397984729320345630340659469435372721057"
+    "8799691705039784490022263632424121050787414990738497037594394780744214"
+    "172427088736048030923213268237603036088416828681032",
+    "1.28402541668774148407342056806243645833628086528146308921750729687220"
+    "7765867238002753306419439553568901662831749679687305854754236046488427"
+    "5017798987295923100456993054879544143902856284789396238267767771229952"
+    "2775202663224663064708173306996899448300891373878866534079230701936447"
+    "557690086324939732608967342670222803054889522818483",
+    "1.45499141461820133605379369198751850834684202096441568119524132818414"
+    "1954319291872336590155391304452969577651507628500247680885177136386677"
+    "0152703205780694170444031398919043264720382912850544438679998370300480"
+    "4298947820448034584301687044337460334702289655208823366252383751816271"
+    "782284850340164655121318429552273347539020305891412",
+    "1.64872127070012814684865078781416357165377610071014801157507931164066"
+    "1021194215608632776520056366643002866637756307797004671166975219609159"
+    "8409714524900597969294226590984039147199484646594892448968689053364184"
+    "6572084106665685980008892498121171228737521497219551197160903409111561"
+    "979986983996064265509175457462630448307519475825878",
+    "1.86824595743222240650183562018810445311497228372255408621476637598482"
+    "5912652124756712949757115420186272260601107672333161124656279243168436"
+    "5711106551298480177408128274336411197567858263618327144363698635751780"
+    "2600792325352169247236470175643786771066055027872980748848344211761710"
+    "450291463323237349962931454931008733342884287736599",
+    "2.11700001661267466854536981983709561013449158470240342177913303081098"
+    "4533364012820002791560266615798218885904719015514262358520338972206019"
+    "4287309647850753815687763740346986575676391837495167514651568288075236"
+    "7495742816186969954619944309357243547947184021122731038105793431669066"
+    "102528974953365851523515428128349852016086796779295",
+    "2.39887529396709791469164573371629674828546587169857889090225468415922"
+    "8881461761024006640966055899945409706044790223172383668510642901053402"
+    "9429817284663833942160383925359410812951743413645712890541529200052365"
+    "1145991277654611942964958688060784257401564431706541108503571972572072"
+    "380242787590619808059939847139058639235611536186440",
+    "2.71828182845904523536028747135266249775724709369995957496696762772407"
+    "6630353547594571382178525166427427466391932003059921817413596629043572"
+    "9003342952605956307381323286279434907632338298807531952510190115738341"
+    "8793070215408914993488416750924476146066808226480016847741185374234544"
+    "243710753907774499206955170276183860626133138458300",
+    "3.08021684891803124500466787877703957705899375982613074033238726933683"
+    "1326011925905658086503559255313429281081577760466749648714727986677104"
+    "3244171498475124794333029357937882905424080724011028950890669108768185"
+    "1056690737311991904240776998121399015039638906265042358264561688469681"
+    "589176254681805481038372074834508419558273140774587",
+    "3.49034295746184137613054602967226548265173439876235162249969673833527"
+    "1802605502380512511252846094298500732281965921804776667964326892714334"
+    "0095682202157505569210450117749792792325872632953061840338095719470042"
+    "9986079164654789044074167642011346436772701918945753754455407790522498"
+    "778941794588410609242443575369019486407684725636164",
+    "3.95507672292057712621095846858945355846306269164672059330208875930859"
+    "3498604019840782388412097864754786339796865235148873667457141605499260"
+    "5690315533446407260997173956749524059380654083325776794976855284534717"
+    "1763492805610534583430759241650950496321656232439026800280699920975301"
+    "852296853078605359792338819749609943689523885115756",
+    "4.48168907033806482260205546011927581900574986836966705677265008278593"
+    "6674466713772981053831382453391388616350651830195768962746477220408606"
+    "9617596449736935381785298966216866555101351015468252930697652168582207"
+    "1458432146288702013831385942062994403661928457350039045117447693303061"
+    "577768618180639748460244422789494333057350155826598",
+    "5.07841903718008111448874895803342428738993370262521179105135643642438"
+    "0857193290527110586519573826682823164797417311643308832557718603507002"
+    "2903782662128062750711138995271333844099460159111387586919744662263504"
+    "9176326899060504511868294807580437441477793990389956009717555194934699"
+    "700038030874916379171151127778583684360012550665570",
+    "5.75460267600573043686649970484269237092292230833652639980921314771742"
+    "0608555205979950346310677042711852190470044500070574189086317537784847"
+    "5986901601060176250162907919056253540369409647661411558040797593826199"
+    "3379310530163321398115905974375878449844619380734565986442366443824468"
+    "654071708730938780501149564188091305261422672289786",
+    "6.52081912033011256532210007964615344456263081687131784185000791597223"
+    "2631144255344063037400618570720692847929006839073578523856140938600227"
+    "1306365692997651808689455083361952202320015935181344148474628250246747"
+    "9702183730569601355317974538594372433808527820375827643806138652794400"
+    "435820069882430387730059595187504512650352623599456",
+    "7.38905609893065022723042746057500781318031557055184732408712782252257"
+    "3796079057763384312485079121794773753161265478866123884603692781273374"
+    "4783922133980777749001228956074107537023913309475506820865818202696478"
+    "6820840422098225523487574246254141467992812933188807076330101933789974"
+    "072998696009530330751532081882368469479302991355877",
+    "8.37289748812726466320470515836998741960152914379181977514904631505998"
+    "7395091453540181251644772410993881033521191779697653748393598071883505"
+    "0250452466688234670377242076318247513754843550035409240433637806615768"
+    "4029877295926396426489638963684316648354800199874601151978908556494619"
+    "871581868610027955657495305341967592590299144377594",
+    "9.48773583635852572055036904451173842377022496766238701010344881596754"
+    "8932396308058390459822129321390437788097546490729043366555338696723797"
+    "6222924489792803522630909017518425459422925497335315848947732189691394"
+    "6082794519946089818610752502888614833294876455557891939318611588320374"
+    "173055518674835705224688297954455880200953429940480"
+};
+
+template <typename D>
+constexpr D to_constant(char const* s, std::size_t const i,
+  std::size_t const c) noexcept
+{ // significant digits [i, i + c) of s, exact
+  using T = typename D::sig_t;
+  using F = typename D::exp2_t;
+
+  T m{};
+  F e(std::string_view(s).find('.')); // place value of the next digit, + 1
+
+  for (std::size_t n{}; *s && (i + c != n); ++s)
+    if ('.' != *s)
+    {
+      --e;
+
+      if ((n || ('0' != *s)) && (n++ >= i)) m = T(10) * m + T(*s - '0');
+    }
+
+  return {m, e};
+}
+
+template <typename D>
+consteval auto exp_digits() noexcept
+{ // digits of the significand and of the largest reduction multiple
+  using F = typename D::exp2_t;
+
+  std::size_t const n(maxpow10e<typename D::sig_t>());
+
+  std::size_t k{};
+
+  for (auto m(std::max(-F(D::emin), F(D::emax)) + F(n + 2)); m; m /= 10, ++k);
+
+  return std::pair(n, k);
+}
+
+template <typename D>
+consteval auto ln10_parts() noexcept
+{ // Cody-Waite split, k * parts[i] is exact
+  constexpr auto n(exp_digits<D>().first), k(exp_digits<D>().second);
+  constexpr auto c(n > k ? n - k : 1);
+
+  std::array<D, (n + k + 3 + c - 1) / c> r{};
+
+  for (std::size_t i{}; r.size() != i; ++i)
+    r[i] = to_constant<D>(ln10_digits, i * c, c);
+
+  return r;
+}
+
+template <typename D>
+consteval auto exp_coefficients() noexcept
+{ // 1 / n!, enough terms for |s| <= 1 / 16
+  constexpr auto N(
+    []() noexcept
+    { // 1 / (16^n * n!) < 10^-(digits + 2)
+      long double p(1), t(1);
+
+      for (auto i(exp_digits<D>().first + 2); i; --i) p /= 10;
+
+      std::size_t n{};
+      for (; t >= p; t /= 16 * ++n);
+
+      return n + 1;
+    }()
+  );
+
+  std::array<D, N> c{D(1), D(1)};
+
+  for (std::size_t i(2); N != i; ++i) c[i] = c[i - 1] / D(i);
+
+  return c;
+}
+
+template <typename D>
+constexpr auto log_reduce(D const& x) noexcept
+{ // x = f * 10^k, 1 / sqrt(10) <= f < sqrt(10), approximately
+  using T = typename D::sig_t;
+  using E = typename D::exp_t;
+  using F = typename D::exp2_t;
+
+  auto const m(x.sig());
+
+  F n{};
+  for (auto t(m); t >= T(10); t /= T(10), ++n);
+
+  if (D const f(direct, m, E(-n)); f < D(direct, T(316), E(-2)))
+    return std::pair(f, F(x.exp()) + n);
+  else
+    return std::pair(D(direct, m, E(-n - 1)), F(x.exp()) + n + F(1));
+}
+
+template <typename D>
+constexpr D expm1_series(D const& s) noexcept
+{ // s + s^2 / 2! + ..., |s| <= 1 / 16
+  constexpr auto c(ar::coeff<exp_coefficients<D>()>());
+
+  auto r(c.back());
+
+  for (auto i(c.size() - 1); --i;) r = fma(r, s, c[i]);
+
+  return r * s;
+}
+
+// fixed point, Q = P + 7 places after the point, P the digits of mmax, in
+// the widest type at hand; the guard digits absorb the truncation errors
+template <typename D>
+struct fixed_t
+{
+  using U = std::conditional_t<
+      std::is_void_v<double_t<typename D::sig2_t>>,
+      typename D::sig2_t,
+      double_t<typename D::sig2_t>
+    >;
+  using F = typename D::exp2_t;
+
+  static constexpr int W{maxpow10e<U>()};
+  static constexpr int Q{maxpow10e<typename D::sig_t>() + 8};
+
+  // a * b fits, if |a|, |b| < 10^(Q + 2), or else a and b are split at 10^h
+  static constexpr bool split{2 * (Q + 2) > W};
+  static constexpr int h{Q / 2 + 1};
+
+  static constexpr auto p10{
+    []() noexcept
+    {
+      std::array<U, W + 1> p{U(1)};
+
+      for (std::size_t i(1); p.size() != i; ++i) p[i] = U(10) * p[i - 1];
+
+      return p;
+    }()
+  };
+
+  static constexpr int digits(U const a) noexcept
+  { // a >= 0
+    return std::upper_bound(p10.begin(), p10.end(), a) - p10.begin();
+  }
+
+  static constexpr U mul(U const a, U const b) noexcept
+  { // a * b / 10^Q, truncated, |a|, |b| < 10^(Q + 2)
+    if constexpr(split)
+    {
+      auto const a1(a / p10[h]), a0(a - a1 * p10[h]);
+      auto const b1(b / p10[h]), b0(b - b1 * p10[h]);
+
+      return a1 * b1 * p10[2 * h - Q] + (a1 * b0 + a0 * b1) / p10[Q - h] +
+        a0 * b0 / p10[Q];
+    }
+    else
+    {
+      return a * b / p10[Q];
+    }
+  }
+
+  static constexpr U div(U const a, U const b) noexcept
+  { // a * 10^Q / b, truncated, |a| < 100 * b, 0 < b < 10^(Q + 2), long
+    // division, c digits at a time
+    constexpr int c(W - Q - 2);
+
+    U q(a / b), r(a - q * b);
+
+    for (int k(Q); k;)
+    {
+      auto const i(std::min(k, c));
+      auto const t(r * p10[i]), d(t / b);
+
+      q = q * p10[i] + d; r = t - d * b; k -= i;
+    }
+
+    return q;
+  }
+
+  static constexpr U from(char const* s) noexcept
+  { // s truncated to Q places after the point
+    U m{};
+
+    for (int n(-1); *s && (n < Q); ++s)
+      if ('.' == *s) n = 0;
+      else m = U(10) * m + U(*s - '0'), n += n >= 0;
+
+    return m;
+  }
+
+  template <typename V>
+  static constexpr V to(U const z, F e, bool x) noexcept
+  { // z * 10^e, rounded once by the constructor of V, x is set if z is
+    // inexact; the digits that do not fit sig2_t go, a sticky digit stays
+    using S = typename V::sig2_t;
+
+    constexpr int L(maxpow10e<S>());
+
+    auto const neg(intt::is_neg(z));
+    auto a(neg ? U(-z) : z);
+
+    if (auto const n(digits(a)); n > L)
+    {
+      auto const& f(p10[n - L]);
+      auto const q(a / f);
+
+      x = x || (a - q * f);
+      e += F(n - L);
+      a = q;
+    }
+
+    if (x && !(a % U(10))) ++a;
+
+    return V(S(neg ? U(-a) : a), e);
+  }
+};
+
+// log_b(m * 10^e) = k log_b(10) + log_b(f), 0.315 <= f < 3.15, ln(f) = ln(t) +
+// 2 atanh((f - t) / (f + t)), t = i / 50 the nearest table point to f
+template <typename D>
+struct ilog_t: fixed_t<D>
+{
+  using B = fixed_t<D>;
+  using typename B::U;
+  using typename B::F;
+
+  using B::Q;
+  using B::p10;
+  using B::mul;
+  using B::div;
+
+  static constexpr U ln10{B::from(ln10_digits)};
+  static constexpr U log2e{B::from(log2e_digits)};
+  static constexpr U log10e{B::from(log10e_digits)};
+  static constexpr U log2_10{mul(ln10, log2e)};
+
+  static constexpr auto c{
+    []() noexcept
+    { // 1 / (2j + 1), enough terms for |u| < 1 / 60
+      constexpr auto N(
+        []() noexcept
+        { // 60^-2n < 10^-(Q + 1)
+          long double p(1), t(1);
+
+          for (auto i(Q + 1); i; --i) p /= 10;
+
+          std::size_t n{};
+          for (; t >= p; t /= 3600, ++n);
+
+          return n;
+        }()
+      );
+
+      std::array<U, N> c;
+
+      for (std::size_t j{}; N != j; ++j) c[j] = p10[Q] / U(2 * j + 1);
+
+      return c;
+    }()
+  };
+
+  static constexpr auto tab{
+    []() noexcept
+    { // ln(i / 50), i = 16 .. 158, from 2 atanh((t - 1) / (t + 1)) - s ln(2),
+      // t = 2^s i / 50, 3 / 4 <= t < 3 / 2
+      constexpr auto ln2(B::from(ln2_digits));
+
+      std::array<U, 143> r{};
+
+      for (int i(16); i <= 158; ++i)
+      {
+        U a(i), b(50);
+        int s{};
+
+        for (; U(4) * a < U(3) * b; a *= U(2), ++s);
+        for (; U(2) * a >= U(3) * b; b *= U(2), --s);
+
+        auto const u(div(a - b, a + b)), v(mul(u, u));
+
+        U t{};
+
+        for (U p(u), j(1); p; p = mul(p, v), j += U(2)) t += p / j;
+
+        r[i - 16] = U(2) * t - U(s) * ln2;
+      }
+
+      return r;
+    }()
+  };
+
+  static constexpr U series(U const v) noexcept
+  { // 1 + v / 3 + v^2 / 5 + ..., atanh(u) = u * series(u^2)
+    auto r(c.back());
+
+    for (auto j(c.size() - 1); j--;) r = c[j] + mul(v, r);
+
+    return r;
+  }
+
+  struct log_t
+  { // z * 10^e, x is set if inexact
+    U z;
+    F e;
+    bool x;
+  };
+
+  template <int b = 0>
+  static constexpr log_t flog1p(U const m, F const e) noexcept
+  { // log_b(1 + r), b = 0 for e, r = m * 10^e, 0 < |r| <= 1 / 100; ln(1 + r) =
+    // r * g, g = 2 / (2 + r) * series(u^2), u = r / (2 + r), to the digits of r
+    auto const R(F(Q) + e >= F{} ? m * p10[Q + e] :
+      F(-Q) - e > F(B::W) ? U{} : m / p10[-Q - e]);
+
+    auto const w(div(p10[Q], U(2) * p10[Q] + R));
+    auto const u(mul(R, w));
+
+    auto g(U(2) * mul(w, series(mul(u, u))));
+
+    // ln(1 + r) < r, g < 1 if r > 0, even if 1 - g is below the digits
+    if (!intt::is_neg(m) && (g >= p10[Q])) g = p10[Q] - U(1);
+
+    auto const a(B::digits(intt::is_neg(m) ? U(-m) : m));
+
+    auto z(mul(m * p10[Q - a], g));
+
+    if constexpr(10 == b) z = mul(z, log10e);
+    else if constexpr(2 == b) z = mul(z, log2e);
+
+    return {z, e + F(a - Q), true};
+  }
+
+  template <int b = 0>
+  static constexpr log_t flog(U const m, F e) noexcept
+  { // log_b(m * 10^e), b = 0 for e, m > 0, unrounded
+    if constexpr(2 == b)
+    { // m * 10^e = 2^j, exactly, if e <= 0 and m = 2^i * 5^-e, j = i + e
+      auto t(m);
+      F j{};
+
+      for (; (j > e) && !(t % U(5)); t /= U(5), --j);
+
+      if ((j == e) && !(t & (t - U(1))))
+      {
+        for (; t > U(1); t /= U(2), ++j);
+
+        return {U(j), {}, false};
+      }
+    }
+
+    auto const n(B::digits(m));
+
+    auto f(n > Q + 1 ? m / p10[n - Q - 1] : m * p10[Q + 1 - n]);
+    e += F(n - 1);
+
+    if (f >= ar::coeff<U(315) * p10[Q - 2]>()) f /= U(10), ++e;
+
+    auto const i((f + p10[Q - 2]) / ar::coeff<U(2) * p10[Q - 2]>());
+
+    if (!e && (U(50) == i)) // ln(f) is small, relative digits count
+      return f == p10[Q] ? log_t{} : flog1p<b>(f - p10[Q], F(-Q));
+
+    auto const t(U(2) * i * p10[Q - 2]);
+    auto const u(div(f - t, f + t));
+
+    auto z(tab[int(i) - 16] + U(2) * mul(u, series(mul(u, u))));
+
+    bool const x(z || ((10 != b) && e));
+
+    if constexpr(10 == b) z = U(e) * p10[Q] + mul(z, log10e);
+    else if constexpr(2 == b) z = U(e) * log2_10 + mul(z, log2e);
+    else z += U(e) * ln10;
+
+    return {z, F(-Q), x};
+  }
+
+  template <typename V, int b = 0>
+  static constexpr V log1p(U const m, F const e) noexcept
+  { // flog1p(), rounded once
+    auto const [z, f, x](flog1p<b>(m, e));
+
+    return B::template to<V>(z, f, x);
+  }
+
+  template <typename V, int b = 0>
+  static constexpr V log(U const m, F const e) noexcept
+  { // flog(), rounded once
+    auto const [z, f, x](flog<b>(m, e));
+
+    return B::template to<V>(z, f, x);
+  }
+};
+
+// exp(t * 10^-Q) in fixed point, t = k ln(10) + j / 8 + s, |s| <= 1 / 16,
+// exp(s) from its series, exp(j / 8) from the table
+template <typename D>
+struct iexp_t: fixed_t<D>
+{
+  using B = fixed_t<D>;
+  using typename B::U;
+  using typename B::F;
+
+  using B::Q;
+  using B::p10;
+  using B::mul;
+
+  static constexpr U ln10{B::from(ln10_digits)};
+
+  static constexpr auto exp8{
+    []() noexcept
+    {
+      std::array<U, std::size(exp8_digits)> r;
+
+      for (std::size_t i{}; r.size() != i; ++i) r[i] = B::from(exp8_digits[i]);
+
+      return r;
+    }()
+  };
+
+  static constexpr auto exp(U const t) noexcept
+  { // exp(t * 10^-Q) = z * 10^e, 10^Q / 2 < z < 11 * 10^Q, truncated
+    auto k(t / ln10);
+    auto r(t - k * ln10);
+
+    if (intt::is_neg(r)) r += ln10, --k;
+
+    auto const j((U(8) * r + p10[Q] / U(2)) / p10[Q]);
+    auto const s(r - j * (p10[Q] / U(8)));
+
+    U z(p10[Q]);
+
+    for (U p(s), i(1); p; p = mul(p, s) / ++i) z += p;
+
+    if (j) z = mul(z, exp8[int(j) - 1]);
+
+    return std::pair(z, F(k) - F(Q));
+  }
+};
+
+template <typename D>
+inline constexpr bool ilog_v(!intt::is_intt_v<typename D::sig2_t>);
+
+template <typename D>
+constexpr D log1p(D const& x) noexcept
+{ // |x| < 1 / 2, Newton, every iteration doubles the digits of the seed
+  auto y(static_cast<D>(log1p(d64(x))));
+
+  for (auto i(
+    []() noexcept
+    {
+      int i{};
+      for (std::size_t d(18); d < exp_digits<D>().first + 2; d *= 2, ++i);
+      return i;
+    }()); i; --i)
+  {
+    auto const t(expm1(y));
+
+    y -= (t - x) / (t + D(1));
+  }
+
+  return y;
+}
+
+}
+
+//
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> exp(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  using namespace detail;
+
+  constexpr auto ln10(ar::coeff<ln10_parts<D>()>());
+  constexpr auto n(exp_digits<D>().first);
+
+  if (isnan(x)) [[unlikely]] return nan;
+  else if (x > ar::coeff<D(F(D::emax) + F(n + 1)) *
+    numbers::ln10_v<D>>()) [[unlikely]] return nan;
+  else if (x < ar::coeff<D(F(D::emin) - F(n + 1)) *
+    numbers::ln10_v<D>>()) [[unlikely]] return {};
+
+  // x = k * ln(10) + j / 8 + s
+  auto const k(floor(x * numbers::log10e_v<D>));
+
+  auto r(x);
+  for (auto& c: ln10) r -= k * c;
+
+  auto const j(std::clamp(int(round(r * D(8))), 0, 18));
+
+  r -= D(direct, T(125 * j), E(-3));
+
+  //
+  auto y(expm1_series(r) + D(1));
+
+  if (j) y *= ar::coeff<
+    []() noexcept
+    {
+      std::array<D, 18> t{};
+
+      for (std::size_t i{}; t.size() != i; ++i)
+        t[i] = to_constant<D>(exp8_digits[i]);
+
+      return t;
+    }()>()[j - 1];
+
+  return isnan(y) ? y : D(U(y.sig()), F(y.exp()) + F(k));
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> expm1(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if (isnan(x)) [[unlikely]] return nan;
+  else if (abs(x) >= D(direct, T(5), E(-1))) return exp(x) - D(1);
+
+  // expm1(2 * y) = expm1(y) * (expm1(y) + 2)
+  auto s(x);
+  int k{};
+
+  for (; abs(s) > D(direct, T(625), E(-4)); ++k) s *= D(direct, T(5), E(-1));
+
+  auto r(detail::expm1_series(s));
+
+  while (k--) r *= r + D(2);
+
+  return r;
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> log(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  using namespace detail;
+
+  if (isnan(x) || (x <= D{})) [[unlikely]] return nan;
+
+  if constexpr(ilog_v<D>)
+  {
+    using L = ilog_t<dpp<T, E>>;
+
+    return L::template log<D>(typename L::U(x.sig()), x.exp());
+  }
+  else
+  {
+    // x = f * 10^k, 1 / sqrt(10) <= f < sqrt(10)
+    auto const [f, k](log_reduce(x));
+
+    if (auto const t(f - D(1)); !k && (abs(t) < D(direct, T(1), E(-1))))
+      return detail::log1p(t); // f - t and exp(y) would cancel
+
+    // Halley, every iteration triples the digits of the d64 seed
+    auto y(static_cast<D>(log(d64(f))));
+
+    for (auto i(
+      []() noexcept
+      {
+        int i{};
+        for (std::size_t d(18); d < exp_digits<D>().first + 2; d *= 3, ++i);
+        return i;
+      }()); i; --i)
+    {
+      auto const t(exp(y));
+
+      y += D(2) * (f - t) / (f + t);
+    }
+
+    //
+    if (k)
+    { // smallest parts first
+      constexpr auto p(ar::coeff<ln10_parts<D>()>());
+
+      D const dk(k);
+
+      for (auto i(p.size()); i--;) y += dk * p[i];
+    }
+
+    return y;
+  }
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> log10(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if (isnan(x) || (x <= D{})) [[unlikely]] return nan;
+
+  if constexpr(detail::ilog_v<D>)
+  {
+    using L = detail::ilog_t<dpp<T, E>>;
+
+    return L::template log<D, 10>(typename L::U(x.sig()), x.exp());
+  }
+  else
+  {
+    auto const [f, k](detail::log_reduce(x));
+
+    return D(k) + log(f) * numbers::log10e_v<D>;
+  }
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> log2(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if (isnan(x) || (x <= D{})) [[unlikely]] return nan;
+
+  if constexpr(detail::ilog_v<D>)
+  {
+    using L = detail::ilog_t<dpp<T, E>>;
+
+    return L::template log<D, 2>(typename L::U(x.sig()), x.exp());
+  }
+  else
+  {
+    return log(x) * numbers::log2e_v<D>;
+  }
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> log1p(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if (isnan(x) || (x <= D(-1))) [[unlikely]] return nan;
+
+  if constexpr(detail::ilog_v<D>)
+  { // 1 + x, exactly, if it fits, or else 1 is below the guard digits
+    using L = detail::ilog_t<dpp<T, E>>;
+    using U = typename L::U;
+    using F = typename L::F;
+
+    U const m(x.sig());
+    F const e(x.exp());
+
+    if (!m) [[unlikely]] return {};
+    else if (abs(x) <= D(direct, T(1), E(-2)))
+      return L::template log1p<D>(m, e);
+    else if (e < F{})
+      return L::template log<D>(m + L::p10[-e], e);
+    else if (L::digits(m) + e < L::W)
+      return L::template log<D>(m * L::p10[e] + U(1), {});
+    else
+      return L::template log<D>(m, e);
+  }
+  else if (abs(x) >= D(direct, T(5), E(-1)))
+  {
+    return log(x + D(1));
+  }
+  else
+  {
+    return detail::log1p(x);
+  }
+}
+
+}
+
+#endif // DPP_EXP_HPP
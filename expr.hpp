@@ -0,0 +1,479 @@
+#ifndef DPP_EXPR_HPP
+# define DPP_EXPR_HPP
+# pragma once
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "dpp.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+// intermediate result, |m| < 10^digits; the digits beyond those of
+// dpp<T, E, R> are guard digits, the last one is sticky, only to() rounds
+template <typename D>
+struct wide
+{
+  using U = typename D::sig2_t;
+  using V = double_t<U>; // void, if there is no wider type
+  using F = typename D::exp2_t;
+
+  static constexpr int W{maxpow10e<U>()};
+  static constexpr int digits{W - 1}; // headroom for an addition
+
+  // without a wider type, m * m does not fit, but m * (m / 10^h) and
+  // m * (m % 10^h) do, if m has no more than sdigits digits
+  static constexpr int sdigits{(2 * W - 1) / 3};
+  static constexpr int h{W - sdigits};
+
+  U m;
+  F e;
+  bool nan;
+  bool inexact;
+
+  static constexpr auto p10{
+    []() noexcept
+    {
+      std::array<U, W + 1> p{U(1)};
+
+      for (std::size_t i(1); p.size() != i; ++i) p[i] = U(10) * p[i - 1];
+
+      return p;
+    }()
+  };
+
+  static constexpr auto c10{
+    []() noexcept
+    { // c10[i] * p10[i] < 10^digits
+      std::array<U, W + 1> c{p10[digits] - U(1)};
+
+      for (std::size_t i(1); c.size() != i; ++i) c[i] = c[i - 1] / U(10);
+
+      return c;
+    }()
+  };
+
+  static constexpr int size(U const a) noexcept
+  { // the digits of |a|
+    return std::upper_bound(p10.begin(), p10.end(),
+      intt::is_neg(a) ? U(-a) : a) - p10.begin();
+  }
+
+  constexpr void round(bool x = {}, int const n = digits) noexcept
+  { // truncates to n digits, with a single division, x is set if digits
+    // below m were cut off already; an inexact m ends in a nonzero digit
+    auto const neg(intt::is_neg(m));
+    auto a(neg ? U(-m) : m);
+
+    if (a >= p10[n]) [[unlikely]]
+    {
+      auto const i(size(a));
+      auto const& f(p10[i - n]);
+      auto const q(a / f);
+
+      x = x || (a - q * f);
+      e += F(i - n);
+      a = q;
+    }
+
+    if ((inexact = inexact || x) && !(a % U(10))) ++a;
+
+    m = neg ? U(-a) : a;
+  }
+
+  constexpr bool shift(F const i) noexcept
+  { // m /= 10^i, e += i, truncates, true if nonzero digits were cut off
+    e += i;
+
+    if (i > F(digits)) return bool(std::exchange(m, U{}));
+
+    auto const q(m / p10[i]);
+    bool const x(m - q * p10[i]);
+
+    m = q;
+
+    return x;
+  }
+
+  constexpr void widen(F i) noexcept
+  { // m *= 10^k, e -= k, k <= i as large as digits allow
+    constexpr auto l(ar::coeff<p10[digits] - U(1)>());
+
+    if (intt::is_neg(m))
+      [&]<auto ...I>(std::index_sequence<I...>) noexcept
+      {
+        (
+          [&]() noexcept -> bool
+          {
+            constexpr auto e0(ar::coeff<pow(F(2), maxpow2e<U>() - I)>());
+            constexpr auto f(ar::coeff<pow(U(10), e0)>());
+
+            if ((e0 <= i) && (m >= ar::coeff<U(-l / f)>()))
+              i -= e0, e -= e0, m *= f;
+
+            return i && (m > ar::coeff<U(-l / 10)>());
+          }() && ...
+        );
+      }(std::make_index_sequence<maxpow2e<U>() + 1>());
+    else
+      [&]<auto ...I>(std::index_sequence<I...>) noexcept
+      {
+        (
+          [&]() noexcept -> bool
+          {
+            constexpr auto e0(ar::coeff<pow(F(2), maxpow2e<U>() - I)>());
+            constexpr auto f(ar::coeff<pow(U(10), e0)>());
+
+            if ((e0 <= i) && (m <= ar::coeff<U(l / f)>()))
+              i -= e0, e -= e0, m *= f;
+
+            return i && (m < ar::coeff<U(l / 10)>());
+          }() && ...
+        );
+      }(std::make_index_sequence<maxpow2e<U>() + 1>());
+  }
+
+  //
+  static constexpr wide from(D const& a) noexcept
+  {
+    return {U(a.sig()), F(a.exp()), bool(isnan(a)), {}};
+  }
+
+  constexpr D to() const noexcept
+  { // the constructor rounds, the sticky digit included
+    if (nan) [[unlikely]] return ::dpp::nan;
+
+    return {m, e};
+  }
+};
+
+template <bool S, typename D>
+constexpr auto add(wide<D> a, wide<D> b) noexcept
+{
+  using U = typename wide<D>::U;
+  using F = typename wide<D>::F;
+
+  constexpr auto& p10(wide<D>::p10);
+  constexpr auto& c10(wide<D>::c10);
+
+  if (a.nan || b.nan) [[unlikely]] return wide<D>{{}, {}, true, {}};
+
+  if constexpr(S) b.m = -b.m;
+
+  if (!b.m) [[unlikely]] return a;
+  else if (!a.m) [[unlikely]] return b;
+
+  bool x{};
+
+  if (a.e != b.e)
+  { // align, the operand with the larger exponent is widened first, if
+    // exact, the other one is cut
+    if (a.e < b.e) std::swap(a, b);
+
+    if (auto const i(a.e - b.e); (i <= F(wide<D>::digits)) &&
+      (a.m <= c10[i]) && (a.m >= -c10[i]) && !a.inexact) [[likely]]
+    {
+      a.m *= p10[i]; a.e = b.e;
+    }
+    else
+    {
+      if (!a.inexact) a.widen(i);
+
+      if (auto const nb(intt::is_neg(b.m)); (x = b.shift(a.e - b.e)))
+      { // a.m + b.m + d, 0 < |d| < 1, d has the sign of b
+        if (auto const s(a.m + b.m); !s || (intt::is_neg(s) != nb))
+          b.m += nb ? U(-1) : U(1); // |s + d| lies between |s| - 1 and |s|
+      }
+    }
+  }
+
+  a.m += b.m;
+  a.inexact = a.inexact || b.inexact;
+  a.round(x);
+
+  return a;
+}
+
+template <typename D>
+constexpr auto mul(wide<D> a, wide<D> b) noexcept
+{
+  using U = typename wide<D>::U;
+  using V = typename wide<D>::V;
+  using F = typename wide<D>::F;
+
+  constexpr auto& p10(wide<D>::p10);
+
+  if (a.nan || b.nan) [[unlikely]] return wide<D>{{}, {}, true, {}};
+
+  if constexpr(std::is_void_v<V>)
+  { // a.m * b.m = hi * 10^h + lo, like ipow_t
+    constexpr auto W(wide<D>::W);
+    constexpr auto h(wide<D>::h);
+
+    a.round({}, wide<D>::sdigits);
+    b.round({}, wide<D>::sdigits);
+
+    a.e += b.e;
+    a.inexact = a.inexact || b.inexact;
+
+    auto const hi(a.m * (b.m / p10[h])), lo(a.m * (b.m % p10[h]));
+
+    if ((hi < p10[W - 1 - h]) && (hi > -p10[W - 1 - h]))
+      a.m = hi * p10[h] + lo, a.round();
+    else
+      a.m = hi + lo / p10[h], a.e += F(h), a.round(lo % p10[h]);
+  }
+  else
+  { // the product fits V, 2 * digits < maxpow10e<V>()
+    auto const k(std::max(wide<D>::size(a.m) + wide<D>::size(b.m) -
+      wide<D>::digits, 0));
+
+    V const p(V(a.m) * V(b.m)), q(p / V(p10[k]));
+
+    a.m = U(q);
+    a.e += b.e + F(k);
+    a.inexact = a.inexact || b.inexact;
+    a.round(p != q * V(p10[k]));
+  }
+
+  return a;
+}
+
+template <typename D>
+constexpr auto div(wide<D> a, wide<D> b) noexcept
+{
+  using U = typename wide<D>::U;
+  using V = typename wide<D>::V;
+  using F = typename wide<D>::F;
+
+  constexpr auto& p10(wide<D>::p10);
+
+  if (a.nan || b.nan || !b.m) [[unlikely]] return wide<D>{{}, {}, true, {}};
+  else if (!a.m) [[unlikely]] return a;
+
+  bool x;
+
+  if constexpr(std::is_void_v<V>)
+  { // long division, c digits at a time, the remainder is below 10^sdigits
+    constexpr auto c(ar::coeff<F(wide<D>::h)>());
+
+    b.round({}, wide<D>::sdigits);
+
+    auto const neg(intt::is_neg(a.m) != intt::is_neg(b.m));
+    U const m(intt::is_neg(b.m) ? U(-b.m) : b.m);
+    auto n(intt::is_neg(a.m) ? U(-a.m) : a.m);
+
+    U q(n / m), r(n - q * m);
+
+    for (; q < p10[wide<D>::digits - c]; a.e -= c)
+    {
+      n = r * p10[c];
+      auto const t(n / m);
+
+      q = q * p10[c] + t; r = n - t * m;
+    }
+
+    a.m = neg ? U(-q) : q;
+    x = bool(r);
+  }
+  else
+  { // a.m * 10^k has digits + size(b.m) digits, the quotient digits or more
+    auto const k(wide<D>::digits - wide<D>::size(a.m) + wide<D>::size(b.m));
+    auto const j(std::min(k, wide<D>::W));
+
+    V const n(V(a.m) * V(p10[j]) * V(p10[k - j])), q(n / V(b.m));
+
+    a.m = U(q);
+    a.e -= F(k);
+    x = n != q * V(b.m);
+  }
+
+  a.e -= b.e;
+  a.inexact = a.inexact || b.inexact;
+  a.round(x);
+
+  return a;
+}
+
+}
+
+// opt-in lazy evaluation: formulas built from lazy() values are evaluated
+// with wide intermediates and rounded once, when converted to dpp<T, E, R>
+namespace expr
+{
+
+template <typename U>
+concept expression = requires(U const& a)
+  {
+    typename U::value_type;
+    { a.eval() } -> std::same_as<detail::wide<typename U::value_type>>;
+  };
+
+template <typename D>
+struct value
+{
+  using value_type = D;
+
+  D a;
+
+  constexpr auto eval() const noexcept { return detail::wide<D>::from(a); }
+  constexpr operator D() const noexcept { return a; }
+};
+
+template <typename D, char O, typename L, typename R>
+struct binary
+{
+  using value_type = D;
+
+  L l;
+  R r;
+
+  constexpr auto eval() const noexcept
+  {
+    if constexpr('+' == O) return detail::add<false>(l.eval(), r.eval());
+    else if constexpr('-' == O) return detail::add<true>(l.eval(), r.eval());
+    else if constexpr('*' == O) return detail::mul(l.eval(), r.eval());
+    else return detail::div(l.eval(), r.eval());
+  }
+
+  constexpr operator D() const noexcept { return eval().to(); }
+};
+
+template <typename D, typename A>
+struct negate
+{
+  using value_type = D;
+
+  A a;
+
+  constexpr auto eval() const noexcept
+  {
+    auto r(a.eval()); r.m = -r.m; return r;
+  }
+
+  constexpr operator D() const noexcept { return eval().to(); }
+};
+
+template <typename D, typename A, typename B, typename C>
+struct fused
+{ // a * b + c
+  using value_type = D;
+
+  A a;
+  B b;
+  C c;
+
+  constexpr auto eval() const noexcept
+  {
+    return detail::add<false>(detail::mul(a.eval(), b.eval()), c.eval());
+  }
+
+  constexpr operator D() const noexcept { return eval().to(); }
+};
+
+}
+
+namespace detail
+{
+
+template <typename U> struct is_dpp : std::false_type {};
+template <typename T, typename E, rounding R>
+struct is_dpp<dpp<T, E, R>> : std::true_type {};
+
+template <typename U>
+concept expr_operand = expr::expression<U> || is_dpp<U>::value ||
+  arithmetic<U>;
+
+template <typename U> struct expr_value { using type = void; };
+
+template <expr::expression U>
+struct expr_value<U> { using type = typename U::value_type; };
+
+template <typename A, typename ...B>
+struct expr_value_of
+{ // the value type of the first expression operand
+  using type = std::conditional_t<
+      std::is_void_v<typename expr_value<A>::type>,
+      typename expr_value_of<B...>::type,
+      typename expr_value<A>::type
+    >;
+};
+
+template <typename A>
+struct expr_value_of<A> { using type = typename expr_value<A>::type; };
+
+template <typename D>
+constexpr auto expr_wrap(auto const& a) noexcept
+{
+  if constexpr(expr::expression<std::remove_cvref_t<decltype(a)>>) return a;
+  else return expr::value<D>{D(a)};
+}
+
+}
+
+namespace expr
+{
+
+template <typename T, typename E, rounding R>
+constexpr auto lazy(dpp<T, E, R> const& a) noexcept
+{
+  return value<dpp<T, E, R>>{a};
+}
+
+template <expression A>
+constexpr auto eval(A const& a) noexcept
+{
+  return typename A::value_type(a);
+}
+
+#define DPP_EXPR_OPERATOR__(OP)\
+template <detail::expr_operand A, detail::expr_operand B>\
+  requires(expression<A> || expression<B>)\
+constexpr auto operator OP(A const& a, B const& b) noexcept\
+{\
+  using D = typename detail::expr_value_of<A, B>::type;\
+\
+  auto l(detail::expr_wrap<D>(a));\
+  auto r(detail::expr_wrap<D>(b));\
+\
+  return binary<D, #OP[0], decltype(l), decltype(r)>{l, r};\
+}
+
+DPP_EXPR_OPERATOR__(+)
+DPP_EXPR_OPERATOR__(-)
+DPP_EXPR_OPERATOR__(*)
+DPP_EXPR_OPERATOR__(/)
+
+template <expression A>
+constexpr auto operator+(A const& a) noexcept { return a; }
+
+template <expression A>
+constexpr auto operator-(A const& a) noexcept
+{
+  return negate<typename A::value_type, A>{a};
+}
+
+template <detail::expr_operand A, detail::expr_operand B,
+  detail::expr_operand C>
+  requires(expression<A> || expression<B> || expression<C>)
+constexpr auto fma(A const& a, B const& b, C const& c) noexcept
+{
+  using D = typename detail::expr_value_of<A, B, C>::type;
+
+  auto x(detail::expr_wrap<D>(a));
+  auto y(detail::expr_wrap<D>(b));
+  auto z(detail::expr_wrap<D>(c));
+
+  return fused<D, decltype(x), decltype(y), decltype(z)>{x, y, z};
+}
+
+}
+
+}
+
+#endif // DPP_EXPR_HPP
@@ -0,0 +1,185 @@
+#ifndef DPP_LINALG_HPP
+# define DPP_LINALG_HPP
+# pragma once
+
+#include <array>
+#include <ostream>
+
+#include "dot.hpp"
+#include "sqrt.hpp"
+
+namespace dpp
+{
+
+// vec<D, 3>{x, y, z}, mat<D, N, M> has N rows of vec<D, M>
+template <typename D, std::size_t N>
+struct vec: std::array<D, N>
+{
+};
+
+template <typename D, std::size_t N, std::size_t M>
+struct mat: std::array<vec<D, M>, N>
+{
+};
+
+// componentwise
+template <typename D, std::size_t N>
+constexpr vec<D, N> operator-(vec<D, N> const& a) noexcept
+{
+  vec<D, N> r;
+
+  for (std::size_t i{}; N != i; ++i) r[i] = -a[i];
+
+  return r;
+}
+
+#define DPP_VEC_OPERATOR__(OP)\
+template <typename D, std::size_t N>\
+constexpr vec<D, N> operator OP(vec<D, N> const& a,\
+  vec<D, N> const& b) noexcept\
+{\
+  vec<D, N> r;\
+\
+  for (std::size_t i{}; N != i; ++i) r[i] = a[i] OP b[i];\
+\
+  return r;\
+}\
+\
+template <typename D, std::size_t N>\
+constexpr vec<D, N> operator OP(vec<D, N> const& a, D const& b) noexcept\
+{\
+  vec<D, N> r;\
+\
+  for (std::size_t i{}; N != i; ++i) r[i] = a[i] OP b;\
+\
+  return r;\
+}\
+\
+template <typename D, std::size_t N>\
+constexpr vec<D, N> operator OP(D const& a, vec<D, N> const& b) noexcept\
+{\
+  vec<D, N> r;\
+\
+  for (std::size_t i{}; N != i; ++i) r[i] = a OP b[i];\
+\
+  return r;\
+}\
+\
+template <typename D, std::size_t N>\
+constexpr auto& operator OP##=(vec<D, N>& a, auto const& b) noexcept\
+{\
+  return a = a OP b;\
+}
+
+DPP_VEC_OPERATOR__(+)
+DPP_VEC_OPERATOR__(-)
+DPP_VEC_OPERATOR__(*)
+DPP_VEC_OPERATOR__(/)
+
+// the reductions are rounded once
+template <typename D, std::size_t N>
+constexpr D dot(vec<D, N> const& a, vec<D, N> const& b) noexcept
+{
+  return detail::dot<N>(a.data(), b.data(), N);
+}
+
+template <typename T, typename E, rounding R>
+constexpr auto cross(vec<dpp<T, E, R>, 3> const& a,
+  vec<dpp<T, E, R>, 3> const& b) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  using namespace detail;
+
+  for (std::size_t i{}; 3 != i; ++i)
+    if (isnan(a[i]) || isnan(b[i])) [[unlikely]]
+      return vec<D, 3>{nan, nan, nan};
+
+  return vec<D, 3>{
+    sum<D, T, E, R>(term(a[1], b[2]), neg(term(a[2], b[1]))),
+    sum<D, T, E, R>(term(a[2], b[0]), neg(term(a[0], b[2]))),
+    sum<D, T, E, R>(term(a[0], b[1]), neg(term(a[1], b[0])))
+  };
+}
+
+template <typename D, std::size_t N>
+constexpr D length(vec<D, N> const& a) noexcept
+{
+  return sqrt(dot(a, a));
+}
+
+template <typename D, std::size_t N>
+constexpr vec<D, N> normalize(vec<D, N> const& a) noexcept
+{ // one reciprocal square root, a product per component
+  return a * rsqrt(dot(a, a));
+}
+
+//
+template <typename D, std::size_t N, std::size_t M>
+constexpr mat<D, M, N> transpose(mat<D, N, M> const& a) noexcept
+{
+  mat<D, M, N> r;
+
+  for (std::size_t i{}; N != i; ++i)
+    for (std::size_t j{}; M != j; ++j) r[j][i] = a[i][j];
+
+  return r;
+}
+
+template <typename D, std::size_t N, std::size_t M>
+constexpr vec<D, N> operator*(mat<D, N, M> const& a,
+  vec<D, M> const& b) noexcept
+{
+  vec<D, N> r;
+
+  for (std::size_t i{}; N != i; ++i) r[i] = dot(a[i], b);
+
+  return r;
+}
+
+template <typename D, std::size_t N, std::size_t K, std::size_t M>
+constexpr mat<D, N, M> operator*(mat<D, N, K> const& a,
+  mat<D, K, M> const& b) noexcept
+{
+  auto const t(transpose(b));
+
+  mat<D, N, M> r;
+
+  for (std::size_t i{}; N != i; ++i) r[i] = t * a[i];
+
+  return r;
+}
+
+// y = a * x for n points, the coordinates in separate arrays (SoA), y may
+// alias x
+template <typename D, std::size_t N, std::size_t M>
+constexpr void transform(mat<D, N, M> const& a,
+  std::array<D const*, M> const& x, std::array<D*, N> const& y,
+  std::size_t const n) noexcept
+{
+  for (std::size_t k{}; n != k; ++k)
+  {
+    vec<D, M> p;
+
+    for (std::size_t j{}; M != j; ++j) p[j] = x[j][k];
+
+    auto const q(a * p);
+
+    for (std::size_t i{}; N != i; ++i) y[i][k] = q[i];
+  }
+}
+
+//
+template <typename D, std::size_t N>
+std::ostream& operator<<(std::ostream& os, vec<D, N> const& a)
+{
+  os << '(';
+
+  for (std::size_t i{}; N != i; ++i) os << (i ? "," : "") << a[i];
+
+  return os << ')';
+}
+
+}
+
+#endif // DPP_LINALG_HPP
@@ -0,0 +1,166 @@
+#ifndef DPP_NUMBERS_HPP
+# define DPP_NUMBERS_HPP
+# pragma once
+
+#include "dpp.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+// digit strings, long enough for the widest significands
+inline constexpr char const e_digits[]{
+  "2.71828182845904523536028747135266249775724709369995957496696762772407"
+  "6630353547594571382178525166427427466391932003059921817413596629043572"
+  "9003342952605956307381323286279434907632338298807531952510190115738341"
+  "8793070215408914993488416750924476146066808226480016847741185374234544"
+  "243710753907774499206955170276183860626133138458300"
+};
+
+inline constexpr char const log2e_digits[]{
+  "1.44269504088896340735992468100189213742664595415298593413544940693110"
+  "9219181185079885526622893506344496997518309652544255593101687168359642"
+  "7206621582234793362745373698847184936307013876635320155338943189166648"
+  "3764312861542404747842228949790479509153035133858805496886589309699636"
+  "803611051107563084414542721582834494189193390857771"
+};
+
+inline constexpr char const log10e_digits[]{
+  "0.43429448190325182765112891891660508229439700580366656611445378316586"
+  "4649208870774729224949338431748318706106744766303733641679287158963906"
+  "5692210646628122658521270865686703295933708696588266883311636077384905"
+  "1428443486667686465860851355614821234876534354343573172538356222813956"
+  "030486466523660955393773561763234319167109914115978"
+};
+
+inline constexpr char const pi_digits[]{
+  "3.14159265358979323846264338327950288419716939937510582097494459230781"
+  "6406286208998628034825342117067982148086513282306647093844609550582231"
+  "7253594081284811174502841027019385211055596446229489549303819644288109"
+  "7566593344612847564823378678316527120190914564856692346034861045432664"
+  "821339360726024914127372458700660631558817488152092"
+};
+
+inline constexpr char const inv_pi_digits[]{
+  "0.31830988618379067153776752674502872406891929148091289749533468811779"
+  "3595268453070180227605532506171912145685453515916073785823692229157305"
+  "7559348214633996784584799338748181551461554927938506153774347857924347"
+  "9532338672478048344725802366476022844539951143188092378017380534791224"
+  "097882187387568817105744619989288680049734469547891"
+};
+
+inline constexpr char const inv_sqrtpi_digits[]{
+  "0.56418958354775628694807945156077258584405062932899885684408572171064"
+  "2468441493414486743660202107363443028347906361707351689931494826162866"
+  "3654895200177689932928376370595984397603524643502179725712115802457728"
+  "2022055450852717321662220846330811139951276345448602306823769091874515"
+  "874661585130106639835777199937733416035779887616674"
+};
+
+inline constexpr char const ln2_digits[]{
+  "0.69314718055994530941723212145817656807550013436025525412068000949339"
+  "3621969694715605863326996418687542001481020570685733685520235758130557"
+  "0326707516350759619307275708283714351903070386238916734711233501153644"
+  "9795523912047517268157493206515552473413952588295045300709532636664265"
+  "410423915781495204374043038550080194417064167151864"
+};
+
+inline constexpr char const ln10_digits[]{
+  "2.30258509299404568401799145468436420760110148862877297603332790096757"
+  "2609677352480235997205089598298341967784042286248633409525465082806756"
+  "6662873690987816894829072083255546808437998948262331985283935053089653"
+  "7773262884616336622228769821988674654366747440424327436515504893431493"
+  "939147961940440022210510171417480036880840126470806"
+};
+
+inline constexpr char const sqrt2_digits[]{
+  "1.41421356237309504880168872420969807856967187537694807317667973799073"
+  "2478462107038850387534327641572735013846230912297024924836055850737212"
+  "6441214970999358314132226659275055927557999505011527820605714701095599"
+  "7160597027453459686201472851741864088919860955232923048430871432145083"
+  "976260362799525140798968725339654633180882964062061"
+};
+
+inline constexpr char const sqrt3_digits[]{
+  "1.73205080756887729352744634150587236694280525381038062805580697945193"
+  "3016908800037081146186757248575675626141415406703029969945094998952478"
+  "8116555120943736485280932319023055820679748201010846749232650153123432"
+  "6690332288665067225466892183797122704713166036786158801904998653737985"
+  "938946765034750657605075661834812960610094760218719"
+};
+
+inline constexpr char const inv_sqrt3_digits[]{
+  "0.57735026918962576450914878050195745564760175127012687601860232648397"
+  "7672302933345693715395585749525225208713805135567676656648364999650826"
+  "2705518373647912161760310773007685273559916067003615583077550051041144"
+  "2230110762888355741822297394599040901571055345595386267301666217912661"
+  "979648921678250219201691887278270986870031586739573"
+};
+
+inline constexpr char const egamma_digits[]{
+  "0.57721566490153286060651209008240243104215933593992359880576723488486"
+  "7726777664670936947063291746749514631447249807082480960504014486542836"
+  "2241739976449235362535003337429373377376739427925952582470949160087352"
+  "0394816567085323315177661152862119950150798479374508570574002992135478"
+  "614669402960432542151905877553526733139925401296742"
+};
+
+inline constexpr char const phi_digits[]{
+  "1.61803398874989484820458683436563811772030917980576286213544862270526"
+  "0462818902449707207204189391137484754088075386891752126633862223536931"
+  "7931800607667263544333890865959395829056383226613199282902678806752087"
+  "6689250171169620703222104321626954862629631361443814975870122034080588"
+  "795445474924618569536486444924104432077134494704956"
+};
+
+template <typename D>
+constexpr D to_constant(char const* s) noexcept
+{ // rounded, the digits are collected in sig2_t
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  U m{};
+  F e{}, n{};
+
+  for (bool dp{}; *s; ++s)
+    if ('.' == *s)
+      dp = true;
+    else if (n < ar::coeff<F(maxpow10e<U>())>())
+      m = U(10) * m + U(*s - '0'), n += bool(m), e -= dp;
+    else
+      e += !dp;
+
+  return {m, e};
+}
+
+}
+
+// like std::numbers, rounded to the precision of D at compile time
+namespace numbers
+{
+
+#define DPP_NUMBER__(ID)\
+template <typename D>\
+inline constexpr D ID##_v{detail::to_constant<D>(detail::ID##_digits)};
+
+DPP_NUMBER__(e)
+DPP_NUMBER__(log2e)
+DPP_NUMBER__(log10e)
+DPP_NUMBER__(pi)
+DPP_NUMBER__(inv_pi)
+DPP_NUMBER__(inv_sqrtpi)
+DPP_NUMBER__(ln2)
+DPP_NUMBER__(ln10)
+DPP_NUMBER__(sqrt2)
+DPP_NUMBER__(sqrt3)
+DPP_NUMBER__(inv_sqrt3)
+DPP_NUMBER__(egamma)
+DPP_NUMBER__(phi)
+
+}
+
+}
+
+#endif // DPP_NUMBERS_HPP
@@ -0,0 +1,371 @@
+#ifndef DPP_POW_HPP
+# define DPP_POW_HPP
+# pragma once
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include "exp.hpp"
+#include "to_integral.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+// intermediate power, in the widest type at hand, |m| < 10^digits; the
+// digits beyond those of D are guard digits, the last one is sticky
+template <typename D>
+struct ipow_t
+{
+  using U = std::conditional_t<
+      std::is_void_v<double_t<typename D::sig2_t>>,
+      typename D::sig2_t,
+      double_t<typename D::sig2_t>
+    >;
+  using F = typename D::exp2_t;
+
+  // without a wider type, m * m does not fit with enough guard digits, but
+  // m * (m / 10^h) and m * (m % 10^h) do
+  static constexpr bool split{std::is_void_v<double_t<typename D::sig2_t>>};
+
+  static constexpr std::size_t W{maxpow10e<U>()};
+  static constexpr std::size_t digits{split ? (2 * W - 1) / 3 : W / 2};
+  static constexpr std::size_t h{W - digits};
+
+  static constexpr auto p10{
+    []() noexcept
+    {
+      std::array<U, W + 1> p{U(1)};
+
+      for (std::size_t i(1); p.size() != i; ++i) p[i] = U(10) * p[i - 1];
+
+      return p;
+    }()
+  };
+
+  U m;
+  F e;
+  bool inexact;
+
+  constexpr void round(bool x = {}) noexcept
+  { // truncates to digits, with a single division, x is set if digits below
+    // m were cut off already; to() rounds only once
+    auto const neg(intt::is_neg(m));
+    auto a(neg ? U(-m) : m);
+
+    if (auto const i(std::upper_bound(p10.begin(), p10.end(), a) -
+      p10.begin()); i > F(digits)) [[likely]]
+    {
+      auto const& f(p10[i - digits]);
+      auto const q(a / f);
+
+      x = x || (a - q * f);
+      e += F(i - digits);
+      a = q;
+    }
+
+    if (x)
+    { // a sticky digit
+      inexact = true;
+
+      if (!(a % U(10))) ++a;
+    }
+
+    m = neg ? U(-a) : a;
+  }
+
+  constexpr auto& operator*=(ipow_t const& o) noexcept
+  {
+    e += o.e; inexact |= o.inexact;
+
+    if constexpr(split)
+    { // m * o.m = hi * 10^h + lo, |hi| < 10^(W - 1), |lo| < 10^W
+      auto const hi(m * (o.m / p10[h])), lo(m * (o.m % p10[h]));
+
+      if ((hi < p10[W - 1 - h]) && (hi > -p10[W - 1 - h]))
+        m = hi * p10[h] + lo, round(); // 1.1 * 10^W fits
+      else // m * o.m has W digits at least, h of them go anyway
+        m = hi + lo / p10[h], e += F(h), round(lo % p10[h]);
+    }
+    else
+    {
+      m *= o.m; round();
+    }
+
+    return *this;
+  }
+
+  constexpr D to(bool const neg) const noexcept
+  {
+    if (neg)
+    { // 1 / r, like the quotient in operator/, a guard digit and a sticky
+      // digit, m may have more digits than 10^e0 / m
+      constexpr auto e0(ar::coeff<F(maxpow10e<U, F>())>());
+
+      auto const n(intt::is_neg(m));
+      auto const a(n ? U(-m) : m);
+
+      U q(ar::coeff<pow(U(10), e0)>() / a),
+        r(ar::coeff<pow(U(10), e0)>() - q * a);
+      F e1(-e0 - e);
+
+      for (; q <= ar::coeff<U(10 * U(D::mmax))>(); --e1)
+      {
+        auto const t(U(10) * r / a);
+
+        q = U(10) * q + t;
+        r = U(10) * r - t * a;
+      }
+
+      if ((r || inexact) && !(q % U(10))) ++q;
+
+      return D(n ? U(-q) : q, e1);
+    }
+    else
+    {
+      return D(m, e);
+    }
+  }
+};
+
+template <typename D>
+constexpr auto ipow(ipow_t<D> b, std::uintmax_t n) noexcept
+{ // exponentiation by squaring, stops once the result is out of range
+  using P = ipow_t<D>;
+  using U = typename P::U;
+  using F = typename P::F;
+
+  // beyond these limits the result is certainly out of range
+  constexpr auto emax(ar::coeff<F(D::emax) + F(P::digits)>());
+  constexpr auto emin(ar::coeff<F(D::emin) - F(2 * P::digits)>());
+
+  P r{U(1), {}, {}};
+
+  for (;;)
+  {
+    // r and b only move away from 1, both diverge if either does
+    if (n & 1) r *= b;
+    else if ((b.e > emax) || (b.e < emin)) [[unlikely]] r = b;
+
+    if ((r.e > emax) || (r.e < emin) || !(n >>= 1)) [[unlikely]] return r;
+
+    b *= b;
+  }
+}
+
+template <typename D>
+constexpr auto ipow(D const& x, std::uintmax_t const n) noexcept
+{
+  using P = ipow_t<D>;
+
+  return ipow<D>(P{typename P::U(x.sig()), typename P::F(x.exp()), {}}, n);
+}
+
+template <typename D>
+constexpr D fpow(D const& x, typename ilog_t<D>::U n,
+  typename D::exp2_t const e) noexcept
+{ // x^y, x > 0, y = n * 10^e, 0 < |n| < 10^20; y ln(x) in fixed point, to Q
+  // places, from ln(x) to Q + 1 digits, exp() of it, rounded once; a power a
+  // hair from a short decimal may be exact, ipow() tells
+  using L = ilog_t<D>;
+  using X = iexp_t<D>;
+  using U = typename L::U;
+  using F = typename D::exp2_t;
+
+  constexpr int P(maxpow10e<typename D::sig_t>() + 1);
+
+  // z of Q + 1 digits = z1 * 10^H + z0, n * z1 and n * z0 fit
+  constexpr int H(std::max(0, L::Q + 22 - L::W));
+
+  // past (max(-emin, emax) + P + 2) ln(10), exp() is out of range
+  constexpr auto tmax(ar::coeff<U(std::max(-F(D::emin), F(D::emax)) +
+    F(P + 2)) * X::ln10>());
+
+  auto [z, f, _](L::template flog<>(U(x.sig()), x.exp()));
+
+  if (!z) [[unlikely]] return D(direct, typename D::sig_t(1));
+
+  auto const n0(n);
+  auto const neg(intt::is_neg(n) != intt::is_neg(z));
+
+  if (intt::is_neg(n)) n = -n;
+  if (intt::is_neg(z)) z = -z;
+
+  if (auto const d(L::digits(z)); d > L::Q + 1)
+    z /= L::p10[d - L::Q - 1], f += F(d - L::Q - 1);
+  else
+    z *= L::p10[L::Q + 1 - d], f -= F(L::Q + 1 - d);
+
+  // y ln(x) = n * (z1 * 10^H + z0) * 10^f, to Q places, t
+  auto const z1(z / L::p10[H]), z0(z - z1 * L::p10[H]);
+  auto const g(e + f + F(L::Q));
+
+  auto const shift([](U const a, F const d) noexcept
+    {
+      return d < F{} ? -d > F(L::W) ? U{} : a / L::p10[-d] : a * L::p10[d];
+    }
+  );
+
+  U t(n * z1);
+
+  if (L::digits(t) + g + F(H) > L::digits(tmax)) [[unlikely]]
+    return neg ? D{} : D(nan);
+  else if ((t = shift(t, g + F(H)) + shift(n * z0, g)) > tmax) [[unlikely]]
+    return neg ? D{} : D(nan);
+
+  auto const [w, k](X::exp(neg ? -t : t));
+
+  // w within a hair of c * 10^s, c of P + 2 digits, is exact if c^q = x^p,
+  // y = p / q in lowest terms
+  auto const s(L::digits(w) - (P + 2));
+  auto const& u(L::p10[s]);
+  auto const c((w + u / U(2)) / u);
+
+  if (auto const r(w - c * u); (r < u / U(100)) && (r > -u / U(100)) &&
+    [&]() noexcept
+    {
+      using I = ipow_t<D>;
+      using V = std::uintmax_t;
+
+      auto a(n);
+      F b(e);
+
+      for (; (b < F{}) && !(a % U(10)); a /= U(10), ++b);
+
+      if ((b >= F{}) || (b < -F(maxpow10e<V>())) || (a > U(max_v<V>)))
+        return false;
+
+      V p(a), q(pow(V(10), -b));
+
+      auto const h(std::gcd(p, q));
+      p /= h; q /= h;
+
+      auto const norm([](I v) noexcept
+        {
+          for (; v.m && !(v.m % U(10)); v.m /= U(10), ++v.e);
+
+          return v;
+        }
+      );
+
+      auto l(ipow<D>(I{c, F(k + s), {}}, q));
+      auto const rr(ipow(x, p));
+
+      if (intt::is_neg(n0))
+        return l *= rr, l = norm(l), !l.inexact && (U(1) == l.m) && !l.e;
+      else
+      {
+        auto const a(norm(l)), b(norm(rr));
+
+        return !a.inexact && !b.inexact && (a.m == b.m) && (a.e == b.e);
+      }
+    }()) [[unlikely]]
+    return L::template to<D>(c, F(k + s), false);
+
+  return L::template to<D>(w, k, true);
+}
+
+template <typename D>
+constexpr D epow(D const& x, D const& y) noexcept
+{ // exp(y ln(x)), x > 0
+  if constexpr(ilog_v<D>)
+    return fpow(x, typename ilog_t<D>::U(y.sig()), y.exp());
+  else
+    return exp(y * log(x));
+}
+
+}
+
+//
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> pow(dpp<T, E, R> const& x, detail::integral auto const n)
+  noexcept
+{
+  using D = dpp<T, E, R>;
+  using U = std::uintmax_t;
+  using F = typename D::exp2_t;
+
+  auto const neg(intt::is_neg(n));
+
+  if (isnan(x)) [[unlikely]] return nan;
+  else if (!n) [[unlikely]] return D(direct, T(1));
+  else if (!x.sig()) [[unlikely]] return neg ? D(nan) : D{};
+
+  // |n|, min_v<> included
+  auto const a(neg ? U(0) - U(n) : U(n));
+
+  auto m(x.sig());
+  F e(x.exp());
+
+  if (!(m % T(10))) detail::slash_zeros(m, e);
+
+  if ((T(1) == m) || (T(-1) == m))
+  { // 10^k, O(1)
+    if (U(std::max(e, F(-e))) >
+      U(ar::coeff<F(D::emax) - F(D::emin)>()) / a) [[unlikely]]
+      return intt::is_neg(e) == neg ? D(nan) : D{};
+
+    return D((a & 1) ? m : T(1), neg ? F(-e * F(a)) : F(e * F(a)));
+  }
+
+  // the error of r grows with a, log(x) is more accurate close to 1
+  if (auto const r(detail::ipow(x, a)); !r.inexact || (a <=
+    ar::coeff<detail::pow(U(10),
+    detail::ipow_t<D>::digits - detail::maxpow10e<T>())>()) ||
+    (abs(abs(x) - D(1)) >= D(direct, T(1), E(-2)))) [[likely]]
+    return r.to(neg);
+  else
+  {
+    auto const y(
+      [&]() noexcept
+      {
+        if constexpr(detail::ilog_v<D>)
+        {
+          using V = typename detail::ilog_t<D>::U;
+
+          return detail::fpow(abs(x), neg ? -V(a) : V(a), {});
+        }
+        else
+          return exp((neg ? -D(a) : D(a)) * log(abs(x)));
+      }()
+    );
+
+    return intt::is_neg(x.sig()) && (a & 1) ? -y : y;
+  }
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> pow(dpp<T, E, R> const& x, dpp<T, E, R> const& y) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if (isnan(x) || isnan(y)) [[unlikely]] return nan;
+  else if (trunc(y) == y)
+  { // integral exponent
+    if (auto const [n, o](to_integral(y)); !o) [[likely]] return pow(x, n);
+    else if (!x.sig()) [[unlikely]]
+      return intt::is_neg(y.sig()) ? D(nan) : D{};
+
+    // huge exponents are multiples of 10, hence even
+    return detail::epow(abs(x), y);
+  }
+  else if (!x.sig()) [[unlikely]]
+    return intt::is_neg(y.sig()) ? D(nan) : D{};
+  else if (intt::is_neg(x.sig())) [[unlikely]] return nan;
+
+  return detail::epow(x, y);
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> pow(dpp<T, E, R> const& x, std::floating_point auto const y)
+  noexcept
+{
+  return pow(x, dpp<T, E, R>(y));
+}
+
+}
+
+#endif // DPP_POW_HPP
@@ -0,0 +1,156 @@
+#ifndef DPP_RADIX_SORT_HPP
+# define DPP_RADIX_SORT_HPP
+# pragma once
+
+#include <array>
+#include <iterator>
+#include <vector>
+
+#include "sort_key.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+// fixed width variant of the sort key, digit pairs are left aligned, so short
+// significands leave trailing zero bytes, which the sort skips over
+template <typename D>
+inline constexpr std::size_t radix_key_size_v(1 +
+  key_exp_size_v<typename D::exp_t> + (maxpow10e<typename D::sig_t>() + 2) / 2);
+
+template <typename D>
+using radix_key_t = std::array<std::uint8_t, radix_key_size_v<D>>;
+
+template <typename D>
+constexpr auto radix_key(D const& a) noexcept
+{
+  using T = typename D::sig_t;
+  using F = typename D::exp2_t;
+
+  constexpr auto ne(key_exp_size_v<typename D::exp_t>);
+  constexpr auto nd(maxpow10e<T>() + 1); // digits of mmax
+
+  constexpr auto p10(
+    []() noexcept
+    {
+      std::array<T, nd> p{T(1)};
+
+      for (std::size_t i(1); nd != i; ++i) p[i] = T(10) * p[i - 1];
+
+      return p;
+    }()
+  );
+
+  radix_key_t<D> k{};
+
+  if (isnan(a)) [[unlikely]] { k.front() = key_nan; return k; }
+  else if (!a.sig()) [[unlikely]] { k.front() = key_zero; return k; }
+
+  //
+  auto const neg(intt::is_neg(a.sig()));
+
+  T m(neg ? T(-a.sig()) : a.sig());
+
+  std::size_t n(1);
+  for (; (nd != n) && (m >= p10[n]); ++n);
+
+  //
+  std::uint8_t const x(neg ? 0xff : 0);
+
+  k.front() = neg ? key_neg : key_pos;
+
+  {
+    auto ae(F(a.exp()) + F(n) - F(1) + ar::coeff<F(F(1) << (8 * ne - 1))>());
+
+    for (auto i(ne); i; ae >>= 8) k[i--] = std::uint8_t(ae) ^ x;
+  }
+
+  // the leading digit opens the first pair, equal values share a key
+  auto i(ne + (n + 1) / 2);
+
+  if (neg) std::fill(k.begin() + i + 1, k.end(), x);
+
+  if (n % 2)
+    k[i--] = std::uint8_t(10 * std::uint8_t(m % T(10))) ^ x, m /= T(10);
+
+  for (; i > ne; --i, m /= T(100)) k[i] = std::uint8_t(m % T(100)) ^ x;
+
+  return k;
+}
+
+template <typename K, typename P>
+void radix_sort(std::vector<std::pair<K, P>>& v)
+{ // LSD, stable, skips byte positions shared by all keys
+  auto const n(v.size());
+
+  if (n < 2) return;
+
+  std::vector<std::array<std::size_t, 256>> h(std::tuple_size_v<K>);
+
+  for (auto const& [k, p]: v)
+    for (std::size_t i{}; k.size() != i; ++i) ++h[i][k[i]];
+
+  std::vector<std::pair<K, P>> t(n);
+
+  for (auto i(std::tuple_size_v<K>); i--;)
+  {
+    auto& c(h[i]);
+
+    if (n == c[v.front().first[i]]) continue;
+
+    for (std::size_t s{}; auto& y: c) s += y, y = s - y; // offsets
+
+    for (auto& y: v) t[c[y.first[i]]++] = std::move(y);
+
+    v.swap(t);
+  }
+}
+
+template <typename I>
+auto radix_order(I const first, I const last)
+{
+  using N = std::iter_difference_t<I>;
+
+  std::vector<std::pair<radix_key_t<std::iter_value_t<I>>, N>> v;
+  v.reserve(last - first);
+
+  for (N i{}; last - first != i; ++i) v.emplace_back(radix_key(first[i]), i);
+
+  radix_sort(v);
+
+  return v;
+}
+
+template <typename I>
+void permute(I const first, auto const& v)
+{
+  std::vector<std::iter_value_t<I>> t;
+  t.reserve(v.size());
+
+  for (auto const& y: v) t.push_back(std::move(first[y.second]));
+
+  std::move(t.begin(), t.end(), first);
+}
+
+}
+
+template <std::random_access_iterator I>
+void radix_sort(I const first, I const last)
+{
+  detail::permute(first, detail::radix_order(first, last));
+}
+
+template <std::random_access_iterator I, std::random_access_iterator J>
+void radix_sort_by_key(I const kfirst, I const klast, J const vfirst)
+{ // sorts the keys [kfirst, klast) and permutes the values alongside
+  auto const v(detail::radix_order(kfirst, klast));
+
+  detail::permute(kfirst, v);
+  detail::permute(vfirst, v);
+}
+
+}
+
+#endif // DPP_RADIX_SORT_HPP
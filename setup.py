@@ -1,3 +1,4 @@
+import numpy
 import os
 import sysconfig
 from setuptools import setup, Extension
@@ -13,7 +14,7 @@ ext_modules = [
     Extension(
         "dpp",
         ["bindings.cpp", nb_src],
-        include_dirs=[nb_include, nb_robin_map],
+        include_dirs=[nb_include, nb_robin_map, numpy.get_include()],
         language="c++",
         extra_compile_args=[
             "-DNDEBUG",
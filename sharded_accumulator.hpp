@@ -0,0 +1,173 @@
+#ifndef DPP_SHARDED_ACCUMULATOR_HPP
+# define DPP_SHARDED_ACCUMULATOR_HPP
+# pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "dpp.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+inline constexpr std::size_t cache_line_size{64};
+
+inline auto thread_index() noexcept
+{ // round-robin, assigned on first use
+  static constinit std::atomic<std::size_t> n;
+  thread_local auto const i(n.fetch_add(1, std::memory_order_relaxed));
+
+  return i;
+}
+
+template <typename D>
+constexpr bool to_quanta(D const& a, typename D::exp2_t const q,
+  std::int64_t& r) noexcept
+{ // r = a / 10^q, rounded like D, false on overflow/nan
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  constexpr auto nd(maxpow10e<std::int64_t>());
+  constexpr auto p10(
+    []() noexcept
+    {
+      std::array<std::int64_t, nd + 1> p{1};
+
+      for (std::size_t i(1); nd + 1 != i; ++i) p[i] = 10 * p[i - 1];
+
+      return p;
+    }()
+  );
+
+  if (isnan(a)) [[unlikely]] return false;
+
+  U m(a.sig());
+
+  if (auto d(F(a.exp()) - q); !m) [[unlikely]] return r = {}, true;
+  else if (d >= 0) [[likely]]
+  {
+    if (d > F(nd)) [[unlikely]] return false;
+
+    auto const c(U(max_v<std::int64_t> / p10[d]));
+
+    if ((m > c) || (m < -c)) [[unlikely]] return false;
+
+    r = std::int64_t(m) * p10[d];
+  }
+  else
+  { // quantize() rounds like D, e.g. floor or ceil
+    m = quantize(a, q).sig();
+
+    if ((m > U(max_v<std::int64_t>)) || (m < U(-max_v<std::int64_t>)))
+      [[unlikely]] return false;
+
+    r = std::int64_t(m);
+  }
+
+  return true;
+}
+
+}
+
+// sums are kept as integer multiples of 10^q, a value is rounded once, when
+// it is added, and the total does not depend on the number of shards;
+// digits below 10^q are lost, a value under half a quantum adds nothing in
+// the half modes, and the range is that of std::int64_t, |sum| < 2^63 * 10^q,
+// a shard or a total past it, or a value past it, yields nan
+template <typename D>
+class sharded_accumulator
+{
+  using F = typename D::exp2_t;
+
+  struct alignas(detail::cache_line_size) shard
+  {
+    std::atomic<std::int64_t> v;
+  };
+
+  F const q_;
+  std::size_t const n_;
+  std::unique_ptr<shard[]> s_;
+
+  std::atomic<bool> nan_{};
+
+  void add(std::int64_t const a) noexcept
+  {
+    constexpr auto max(detail::max_v<std::int64_t>);
+    constexpr auto min(detail::min_v<std::int64_t>);
+
+    auto const o(s_[detail::thread_index() % n_].v.fetch_add(a,
+      std::memory_order_relaxed));
+
+    if (((a > 0) && (o > max - a)) || ((a < 0) && (o < min - a)))
+      [[unlikely]] nan_.store(true, std::memory_order_relaxed);
+  }
+
+public:
+  explicit sharded_accumulator(F const q, std::size_t const n =
+    std::thread::hardware_concurrency()):
+    q_(q),
+    n_(n ? n : 1),
+    s_(new shard[n_]{})
+  {
+  }
+
+  sharded_accumulator(sharded_accumulator const&) = delete;
+  sharded_accumulator& operator=(sharded_accumulator const&) = delete;
+
+  //
+  auto& operator+=(D const& a) noexcept { return add(a), *this; }
+  auto& operator-=(D const& a) noexcept { return sub(a), *this; }
+
+  explicit operator D() const noexcept { return load(); }
+
+  //
+  auto quantum() const noexcept { return q_; }
+  auto shards() const noexcept { return n_; }
+
+  void add(D const& a) noexcept
+  {
+    if (std::int64_t m; detail::to_quanta(a, q_, m)) [[likely]] add(m);
+    else [[unlikely]] nan_.store(true, std::memory_order_relaxed);
+  }
+
+  void sub(D const& a) noexcept { add(-a); }
+
+  D load() const noexcept
+  { // a snapshot, writers may continue
+    if (nan_.load(std::memory_order_relaxed)) [[unlikely]] return nan;
+
+    constexpr auto max(detail::max_v<std::int64_t>);
+    constexpr auto min(detail::min_v<std::int64_t>);
+
+    std::int64_t r{};
+
+    for (std::size_t i{}; n_ != i; ++i)
+    {
+      auto const a(s_[i].v.load(std::memory_order_relaxed));
+
+      if (((a > 0) && (r > max - a)) || ((a < 0) && (r < min - a)))
+        [[unlikely]] return nan;
+
+      r += a;
+    }
+
+    return {typename D::sig2_t(r), q_};
+  }
+
+  void clear() noexcept
+  { // not atomic with respect to concurrent writers
+    for (std::size_t i{}; n_ != i; ++i)
+      s_[i].v.store({}, std::memory_order_relaxed);
+
+    nan_.store(false, std::memory_order_relaxed);
+  }
+};
+
+}
+
+#endif // DPP_SHARDED_ACCUMULATOR_HPP
@@ -0,0 +1,156 @@
+#ifndef DPP_SORT_KEY_HPP
+# define DPP_SORT_KEY_HPP
+# pragma once
+
+#include <cstddef> // std::byte
+#include <span>
+
+#include "dpp.hpp"
+
+namespace dpp
+{
+
+// key layout:
+// class byte (negative < zero < positive < nan)
+// biased adjusted exponent, big endian, sizeof(E) + 1 bytes
+// base 100 digit pairs, 2 * p + 1, last pair 2 * p
+// all bytes following the class byte are inverted for negative values
+namespace detail
+{
+
+enum : unsigned char { key_neg = 1, key_zero, key_pos, key_nan };
+
+template <typename E>
+inline constexpr std::size_t key_exp_size_v(ar::bit_size_v<E> / 8 + 1);
+
+}
+
+template <typename D>
+inline constexpr std::size_t sort_key_max_size_v(1 +
+  detail::key_exp_size_v<typename D::exp_t> +
+  (detail::maxpow10e<typename D::sig_t>() + 2) / 2);
+
+template <typename T, typename E, rounding R>
+constexpr std::size_t to_sort_key(dpp<T, E, R> const& a,
+  std::span<std::byte> const s) noexcept
+{ // returns the number of bytes written, 0 if s is too small
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  if (s.empty()) [[unlikely]] return {};
+  else if (isnan(a)) [[unlikely]]
+    return s.front() = std::byte(detail::key_nan), 1;
+  else if (!a.sig()) [[unlikely]]
+    return s.front() = std::byte(detail::key_zero), 1;
+
+  //
+  auto const neg(intt::is_neg(a.sig()));
+
+  T m(neg ? T(-a.sig()) : a.sig());
+  F e(a.exp());
+
+  detail::slash_zeros(m, e); // 1.0 and 1.00 share a key
+
+  std::size_t n{};
+  for (auto t(m); t; ++n, t /= T(10));
+
+  U u(m);
+  if (n % 2) u *= U(10); // pad to whole pairs
+
+  //
+  constexpr auto ne(detail::key_exp_size_v<E>);
+  auto const np((n + 1) / 2);
+
+  if (auto const sz(1 + ne + np); sz > s.size()) [[unlikely]] return {};
+  else
+  {
+    auto const x(std::byte(neg ? 0xff : 0x00));
+
+    s.front() = std::byte(neg ? detail::key_neg : detail::key_pos);
+
+    {
+      auto ae(e + F(n) - F(1) + ar::coeff<F(F(1) << (8 * ne - 1))>());
+
+      for (auto i(ne); i; ae >>= 8) s[i--] = std::byte(std::uint8_t(ae)) ^ x;
+    }
+
+    for (auto i(sz - 1); i > ne; --i, u /= U(100))
+    {
+      auto const p(std::uint8_t(u % U(100)));
+
+      s[i] = std::byte(2 * p + (sz - 1 != i)) ^ x;
+    }
+
+    return sz;
+  }
+}
+
+template <typename D>
+constexpr D from_sort_key(std::span<std::byte const> const s) noexcept
+{
+  using T = typename D::sig_t;
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  constexpr auto ne(detail::key_exp_size_v<typename D::exp_t>);
+
+  if (s.empty()) [[unlikely]] return nan;
+
+  switch (std::to_integer<unsigned char>(s.front()))
+  {
+    case detail::key_zero:
+      return {direct, T{}};
+
+    [[likely]] case detail::key_neg: case detail::key_pos:
+      break;
+
+    default:
+      return nan;
+  }
+
+  //
+  auto const neg(detail::key_neg == std::to_integer<unsigned>(s.front()));
+  auto const x(std::byte(neg ? 0xff : 0x00));
+
+  if (s.size() <= 1 + ne) [[unlikely]] return nan;
+
+  F ae{};
+
+  for (std::size_t i(1); i <= ne; ++i)
+    ae = ae * F(256) + F(std::to_integer<unsigned>(s[i] ^ x));
+
+  ae -= ar::coeff<F(F(1) << (8 * ne - 1))>();
+
+  //
+  U m{};
+  F n{};
+
+  for (auto i(ne + 1); s.size() != i; ++i, n += F(2))
+  {
+    if (n > ar::coeff<F(detail::maxpow10e<T>())>()) [[unlikely]] break;
+
+    auto const b(std::to_integer<unsigned>(s[i] ^ x));
+
+    m = m * U(100) + U(b / 2);
+
+    if (!(b % 2))
+    {
+      n += F(2);
+
+      if (!(b / 2 % 10)) --n, m /= U(10);
+
+      auto e(ae - n + F(1));
+
+      for (; e > ar::coeff<F(D::emax)>(); --e) // undo slashing
+        if (m <= ar::coeff<U(D::mmax) / U(10)>()) m *= U(10); else break;
+
+      return D(neg ? U(-m) : m, e);
+    }
+  }
+
+  return nan;
+}
+
+}
+
+#endif // DPP_SORT_KEY_HPP
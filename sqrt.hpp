@@ -2,6 +2,12 @@
 # define DPP_SQRT_HPP
 # pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
 #include "dpp.hpp"
 
 namespace dpp
@@ -10,9 +16,9 @@ namespace dpp
 namespace detail
 {
 
-template <typename T, typename E>
+template <typename T, typename E, rounding R>
 constexpr auto sqrt(intt::is_intt auto m,
-  typename dpp<T, E>::exp2_t e) noexcept
+  typename dpp<T, E, R>::exp2_t e) noexcept
 {
   using V = decltype(m);
   using exp2_t = decltype(e);
@@ -52,45 +58,231 @@ constexpr auto sqrt(intt::is_intt auto m,
   while (ar::ucmp(m.v_, ar::coeff<V::max() / 5>().v_) <= 0);
 
   //
-  if constexpr(ar::seqsqrt(m.v_); V::words > 1)
+  auto const n(m);
+
+  ar::seqsqrt(m.v_);
+
+  // a sticky digit, e stays even
+  e -= 2;
+  m = V(10) * m + (m * m != n ? V(1) : V{});
+
+  if constexpr(V::words > 1)
   {
-    return dpp<T, E>(m, e / 2);
+    return dpp<T, E, R>(m, e / 2);
   }
   else
   {
-    return dpp<T, E>(m.v_.front(), e / 2);
+    return dpp<T, E, R>(m.v_.front(), e / 2);
+  }
+}
+
+template <typename D>
+struct isqrt_t
+{ // integer square roots below H = C^2, C the multiple of 10 above mmax, the
+  // roots can reach past mmax
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  static constexpr int P{maxpow10e<typename D::sig_t>() + 1};
+
+  static constexpr U C{U(10) * ((U(D::mmax) + U(10)) / U(10))};
+  static constexpr U H{C * C};
+
+  static constexpr auto p10{
+    []() noexcept
+    {
+      std::array<U, maxpow10e<U>() + 1> p{U(1)};
+
+      for (std::size_t i(1); p.size() != i; ++i) p[i] = U(10) * p[i - 1];
+
+      return p;
+    }()
+  };
+
+  static constexpr int digits(U const m) noexcept
+  {
+    return std::upper_bound(p10.begin(), p10.end(), m) - p10.begin();
+  }
+
+  static constexpr U root(U const M) noexcept
+  { // floor(sqrt(M)), 0 < M < H, the seed is off by a few units at most
+    U s;
+
+    if (std::is_constant_evaluated())
+    { // Newton, from above
+      s = p10[(digits(M) + 1) / 2];
+
+      for (U t; (t = (s + M / s) / U(2)) < s; s = t);
+    }
+    else if constexpr(P <= std::numeric_limits<double>::digits10)
+      s = U(std::sqrt(double(M))); // s fits the mantissa
+    else // Newton
+      s = U(std::sqrt((long double)(M))), s = (s + M / s) / U(2);
+
+    while (s * s > M) --s;
+    while ((s + U(1)) * (s + U(1)) <= M) ++s;
+
+    return s;
+  }
+
+  static constexpr D round(U const s, U const g, F const e) noexcept
+  { // (s + g / 10) * 10^e, g is 0 if exact, 5 on a tie, 4 or 6 otherwise,
+    // the constructor rounds, past mmax as well
+    return D(U(10) * s + g, e - F(1));
+  }
+};
+
+template <typename D>
+inline constexpr bool isqrt_v(!intt::is_intt_v<typename D::sig2_t>);
+
+template <typename T, typename E, rounding R>
+constexpr auto isqrt(dpp<T, E, R> const& a) noexcept
+{ // a > 0, sqrt(a) = sqrt(M) * 10^e, M = a.sig() * 10^k in [H / 100, H),
+  // s = floor(sqrt(M)) in [C / 10, C)
+  using S = isqrt_t<dpp<T, E, R>>;
+  using U = typename S::U;
+  using F = typename S::F;
+
+  U const m(a.sig());
+
+  // M has 2P - 3 or 2P - 2 digits, k - a.exp() even
+  auto k(F(2 * S::P - 2) - F(S::digits(m)));
+
+  if ((F(a.exp()) - k) % F(2)) --k;
+
+  U M(m * S::p10[k]);
+
+  for (; M < ar::coeff<S::H / U(100)>(); M *= U(100), k += F(2));
+
+  auto const s(S::root(M));
+  auto const r(M - s * s);
+
+  // the root is irrational, if inexact, r <= 2 * s
+  return S::round(s,
+    !r ? U{} : r > s ? U(6) : U(4), (F(a.exp()) - k) / F(2));
+}
+
+template <typename T, typename E, rounding R>
+constexpr auto rsqrt(dpp<T, E, R> const& a) noexcept
+{ // a > 0, 1 / sqrt(a) = sqrt(X) * 10^e, X = 10^K / a.sig() = N + r / a.sig(),
+  // N in [H / 100, H), sqrt(N) and sqrt(X) have the same floor q
+  using S = isqrt_t<dpp<T, E, R>>;
+  using U = typename S::U;
+  using F = typename S::F;
+
+  // r * 10^c fits
+  constexpr auto c(ar::coeff<F(maxpow10e<U>() - S::P)>());
+
+  U const m(a.sig());
+
+  // N has 2P - 3 or 2P - 2 digits, K + a.exp() even
+  auto K(F(2 * S::P - 4) + F(S::digits(m)));
+
+  if ((K + F(a.exp())) % F(2)) ++K;
+
+  // N = floor(10^K / m), long division, c digits at a time
+  U N{}, r(1);
+
+  for (auto k(K); k;)
+  {
+    auto const i(std::min(k, c));
+    auto const t(r * S::p10[i]);
+    auto const q(t / m);
+
+    N = N * S::p10[i] + q; r = t - q * m; k -= i;
+  }
+
+  for (; N < ar::coeff<S::H / U(100)>(); K += F(2))
+  {
+    auto const t(U(100) * r);
+    auto const q(t / m);
+
+    N = U(100) * N + q; r = t - q * m;
   }
+
+  auto const q(S::root(N));
+  auto const t(N - q * q);
+
+  // the digit below q: 5 if sqrt(X) = q + 1/2, 4 or 6 on either side
+  return S::round(q, !t && !r ? U{} :
+    t < q ? U(4) : t > q ? U(6) :
+    U(4) * r < m ? U(4) : U(4) * r > m ? U(6) : U(5), -(K + F(a.exp())) / F(2));
 }
 
 }
 
-template <std::integral T, typename E>
-constexpr auto sqrt(dpp<T, E> const& a) noexcept
+template <std::integral T, typename E, rounding R>
+constexpr auto sqrt(dpp<T, E, R> const& a) noexcept
 {
   using U = std::make_unsigned_t<T>;
 
-  if constexpr(std::is_same_v<U, std::uintmax_t>)
+  if (isnan(a) || intt::is_neg(a.sig())) [[unlikely]] return dpp<T, E, R>(nan);
+  else if (!a.sig()) [[unlikely]] return dpp<T, E, R>{};
+
+  if constexpr(detail::isqrt_v<dpp<T, E, R>>)
+    return detail::isqrt(a);
+  else if constexpr(std::is_same_v<U, std::uintmax_t>)
   {
     using V = intt::intt<U, 2>;
 
-    return detail::sqrt<T, E>(V(intt::direct, U(a.sig())), a.exp());
+    return detail::sqrt<T, E, R>(V(intt::direct, U(a.sig())), a.exp());
   }
   else
   {
     using D = ar::D<U>;
     using V = intt::intt<D, 1>;
 
-    return detail::sqrt<T, E>(V(intt::direct, D(a.sig())), a.exp());
+    return detail::sqrt<T, E, R>(V(intt::direct, D(a.sig())), a.exp());
   }
 }
 
-template <intt::is_intt T, typename E>
-constexpr auto sqrt(dpp<T, E> const& a) noexcept
+template <intt::is_intt T, typename E, rounding R>
+constexpr auto sqrt(dpp<T, E, R> const& a) noexcept
 {
   using U = typename T::value_type;
+
+  if (isnan(a) || intt::is_neg(a.sig())) [[unlikely]] return dpp<T, E, R>(nan);
+  else if (!a.sig()) [[unlikely]] return dpp<T, E, R>{};
+
   using V = intt::intt<U, 2 * T::size()>;
 
-  return detail::sqrt<T, E>(V(intt::direct, a.sig()), a.exp());
+  return detail::sqrt<T, E, R>(V(intt::direct, a.sig()), a.exp());
+}
+
+//
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> rsqrt(dpp<T, E, R> const& a) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if (isnan(a) || (a <= D{})) [[unlikely]] return nan;
+
+  if constexpr(detail::isqrt_v<D>)
+    return detail::rsqrt(a);
+  else
+    return inv(sqrt(a));
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> hypot(dpp<T, E, R> const& a, dpp<T, E, R> const& b) noexcept
+{
+  using D = dpp<T, E, R>;
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  if (isnan(a) || isnan(b)) [[unlikely]] return nan;
+  else if (!a.sig()) [[unlikely]] return abs(b);
+  else if (!b.sig()) [[unlikely]] return abs(a);
+
+  // hypot(a, b) = hypot(a * 10^-s, b * 10^-s) * 10^s, the squares can't
+  // overflow
+  F const s(std::max(a.exp(), b.exp()));
+
+  D const x(U(a.sig()), F(a.exp()) - s), y(U(b.sig()), F(b.exp()) - s);
+
+  auto const r(sqrt(fma(x, x, y * y)));
+
+  return isnan(r) ? r : D(U(r.sig()), F(r.exp()) + s);
 }
 
 }
@@ -0,0 +1,55 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../atomic.hpp"
+
+using namespace dpp::literals;
+
+// g++ -std=c++20 -O2 -mcx16 atomic.cpp -latomic
+template <typename D>
+void run(D const step)
+{
+  std::atomic<D> sum, lo(D::max), hi(D::min);
+
+  {
+    std::vector<std::jthread> t;
+
+    for (int i{}; 8 != i; ++i)
+      t.emplace_back(
+        [&, i]() noexcept
+        {
+          for (int j{}; 10000 != j; ++j)
+          {
+            sum.fetch_add(step);
+
+            D const v(i * 10000 + j);
+            lo.fetch_min(v);
+            hi.fetch_max(v);
+          }
+        }
+      );
+  }
+
+  std::cout << sum.load() << ' ' << lo.load() << ' ' << hi.load() << ' ' <<
+    std::atomic<D>::is_always_lock_free << ' ' << sum.is_lock_free() <<
+    std::endl;
+}
+
+int main()
+{
+  run(.01_d32);
+  run(.01_d64);
+
+  //
+  std::atomic<dpp::d64> a(1.5_d64);
+  auto e(1.50_d64);
+
+  std::cout << a.compare_exchange_strong(e, 2_d64) << ' ' << e << std::endl;
+  std::cout << a.exchange(dpp::nan) << ' ' << a.load() << std::endl;
+
+  e = dpp::nan;
+  std::cout << a.compare_exchange_strong(e, 3_d64) << ' ' << a.load() << std::endl;
+
+  return 0;
+}
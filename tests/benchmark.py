@@ -1,49 +1,231 @@
+"""dpp vs decimal.Decimal (at matched precision) vs float
+
+    python benchmark.py -o base.json
+    python benchmark.py --check base.json --tolerance 0.1
+
+writes json to stdout (or -o), with per-operation times in ns; --check exits
+with 1, if a case got slower than the baseline by more than the tolerance
+"""
+import argparse
+import copy
 import decimal
 from decimal import Decimal
 import dpp
 import gc
+import json
+import math
+import platform
+import random
+import statistics
 import sys
 import time
 
-def run_benchmark(type_name, iterations=3_000_000, repeats=6):
-    prec_map = {"d32": 7, "d64": 16, "d128": 34}
-    target_prec = prec_map.get(type_name, 28)
-    decimal.getcontext().prec = target_prec
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+WIDTHS = ["d16", "d24", "d32", "d48", "d64", "d96", "d128", "d256", "d512",
+          "d1024"]
+
+class Impl:
+    def __init__(self, name, make, sqrt, copy, array=None, prec=None):
+        self.name = name
+        self.make = make
+        self.sqrt = sqrt
+        self.copy = copy
+        self.array = array
+        self.prec = prec
+
+def dpp_impl(width):
+    cl = getattr(dpp, width)
+    ar = getattr(dpp, f"array_{width}", None)
+
+    # every value with one digit less than max.sig() is representable
+    prec = len(cl.max.to_decimal().as_tuple().digits) - 1
+
+    return Impl(f"dpp.{width}", cl, dpp.sqrt, copy.copy, ar, prec)
+
+def decimal_impl(prec):
+    return Impl("decimal", Decimal, Decimal.sqrt, lambda x: x, None, prec)
+
+def float_impl():
+    return Impl("float", float, math.sqrt, lambda x: x,
+                np.array if np else None)
+
+# each case returns a callable, that performs len(a) operations
+def inplace_add(m, a, b):
+    def f():
+        s = m.copy(a[0])
+        for y in b:
+            s += y
+    return f
+
+def inplace_mul(m, a, b):
+    c = m.make("1.0001")
+
+    def f():
+        s = m.copy(a[0])
+        for _ in b:
+            s *= c
+            s /= c
+    return f
+
+def array_expr(m, a, b):
+    if not m.array:
+        return None
+
+    aa, ab = m.array(a), m.array(b)
+
+    return lambda: ((aa + ab) * aa / ab).sum()
+
+CASES = {
+    "add": lambda m, a, b: lambda: [x + y for x, y in zip(a, b)],
+    "sub": lambda m, a, b: lambda: [x - y for x, y in zip(a, b)],
+    "mul": lambda m, a, b: lambda: [x * y for x, y in zip(a, b)],
+    "div": lambda m, a, b: lambda: [x / y for x, y in zip(a, b)],
+    "expr": lambda m, a, b: lambda: [(x + y) * x / y for x, y in zip(a, b)],
+    "iadd": inplace_add,
+    "imul": inplace_mul,
+    "parse": lambda m, a, b: lambda: [m.make(s) for s in b.strings],
+    "format": lambda m, a, b: lambda: [str(x) for x in a],
+    "hash": lambda m, a, b: lambda: [hash(x) for x in a],
+    "sort": lambda m, a, b: lambda: sorted(a),
+    "sqrt": lambda m, a, b: lambda: [m.sqrt(x) for x in a],
+    "array": array_expr,
+}
+
+class Operands(list):
+    pass
+
+def operands(m, strings):
+    r = Operands(m.make(s) for s in strings)
+    r.strings = strings
+
+    return r
+
+def measure(f, n, repeats):
+    f()
 
-    print(f"--- Benchmarking {type_name} (Best of {repeats} runs) ---")
+    t = []
 
-    val_str_a, val_str_b = "1.234567", "9.876543"
+    for _ in range(repeats):
+        start = time.perf_counter_ns()
+        f()
+        t.append(time.perf_counter_ns() - start)
 
-    def get_best_time(a, b):
-        t = sys.float_info.max
+    return {"min_ns": min(t) / n, "median_ns": statistics.median(t) / n}
 
-        for _ in range(iterations // 10):
-            res = (a + b) * a / b
+def run(impl, cases, size, repeats):
+    r = random.Random(0)
 
-        for _ in range(repeats):
-            start = time.perf_counter()
-            for _ in range(iterations):
-                res = (a + b) * a / b
-            t = min(t, time.perf_counter() - start)
+    sa = [f"{r.uniform(1, 1000):.6f}" for _ in range(size)]
+    sb = [f"{r.uniform(1, 1000):.6f}" for _ in range(size)]
 
-        return t
+    results = {}
+
+    with decimal.localcontext() as ctx:
+        if impl.prec:
+            ctx.prec = impl.prec
+
+        a, b = operands(impl, sa), operands(impl, sb)
+
+        for c in cases:
+            if f := CASES[c](impl, a, b):
+                results[f"{c}/{impl.name}"] = measure(f, size, repeats)
+
+    return results
+
+def compare(results, statistic):
+    # ratios > 1 mean dpp is faster
+    for k, v in results.items():
+        c, name = k.split("/")
+
+        if not name.startswith("dpp."):
+            continue
+
+        for other in ("decimal", "float"):
+            if o := results.get(f"{c}/{other}@{name[4:]}",
+                                results.get(f"{c}/{other}")):
+                v[f"vs_{other}"] = o[statistic] / v[statistic]
+
+def check(results, baseline, statistic, tolerance):
+    regressions = []
+
+    for k, v in results.items():
+        if (b := baseline.get(k)) and \
+           (v[statistic] > b[statistic] * (1 + tolerance)):
+            regressions.append(k)
+            print(f"{k}: {b[statistic]:.1f}ns -> {v[statistic]:.1f}ns",
+                  file=sys.stderr)
+
+    return regressions
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    p.add_argument("--widths", default=",".join(WIDTHS))
+    p.add_argument("--cases", default=",".join(CASES))
+    p.add_argument("--size", type=int, default=10_000,
+                   help="operations per run")
+    p.add_argument("--repeats", type=int, default=7)
+    p.add_argument("-o", "--output")
+    p.add_argument("--check", metavar="BASELINE")
+    p.add_argument("--tolerance", type=float, default=.1)
+    p.add_argument("--statistic", choices=["min_ns", "median_ns"],
+                   default="min_ns")
+    args = p.parse_args()
+
+    widths = [w for w in args.widths.split(",") if hasattr(dpp, w)]
+    cases = args.cases.split(",")
+
+    if unknown := set(cases) - set(CASES):
+        p.error(f"unknown cases: {', '.join(sorted(unknown))}")
 
     gc.collect()
     gc.disable()
 
-    py_a, py_b = Decimal(val_str_a), Decimal(val_str_b)
-    py_time = get_best_time(py_a, py_b)
-    print(f"{'Python Decimal':<{16}}: {py_time:.4f}s")
+    results = run(float_impl(), cases, args.size, args.repeats)
+
+    for w in widths:
+        m = dpp_impl(w)
+
+        results |= run(m, cases, args.size, args.repeats)
 
-    dpp_class = getattr(dpp, type_name)
-    dpp_a, dpp_b = dpp_class(val_str_a), dpp_class(val_str_b)
-    dpp_time = get_best_time(dpp_a, dpp_b)
-    print(f"{f'dpp.{type_name}':<{16}}: {dpp_time:.4f}s")
+        # decimal at the precision of the width
+        for k, v in run(decimal_impl(m.prec), cases, args.size,
+                        args.repeats).items():
+            results[f"{k}@{w}"] = v
 
     gc.enable()
 
-    print(f"{'Speedup':<{16}}: {py_time / dpp_time:.2f}x\n")
+    compare(results, args.statistic)
+
+    out = {
+        "meta": {
+            "python": sys.version,
+            "platform": platform.platform(),
+            "numpy": np.__version__ if np else None,
+            "threads": dpp.get_num_threads(),
+            "size": args.size,
+            "repeats": args.repeats,
+        },
+        "results": results,
+    }
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(out, f, indent=2)
+    else:
+        json.dump(out, sys.stdout, indent=2)
+        print()
+
+    if args.check:
+        with open(args.check) as f:
+            baseline = json.load(f)["results"]
+
+        if check(results, baseline, args.statistic, args.tolerance):
+            sys.exit(1)
 
 if __name__ == "__main__":
-    for t in ["d32", "d64", "d128"]:
-        run_benchmark(t)
+    main()
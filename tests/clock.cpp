@@ -6,14 +6,14 @@
 #include <thread>
 #include <csignal>
 #include <array>
-#include "../dpp.hpp"
+#include "../trig.hpp"
 
 using namespace dpp::literals;
 using D = dpp::d32;
 
 // Configuration namespace to group related constants for better readability
 namespace config {
-  static inline D PI = D(3.14159265358979323846264338327950288);
+  static constexpr D PI = dpp::numbers::pi_v<D>;
   static constexpr int WIDTH = 40;   // Width of the terminal clock display
   static constexpr int HEIGHT = 20;  // Height of the terminal clock display
   static constexpr int RADIUS = std::min(WIDTH, HEIGHT) / 2 - 1;  // Radius for clock face
@@ -55,8 +55,8 @@ class TerminalClock {
   void drawClockFace() {
     // Draw circle border using trigonometric calculations
     for (D angle{}; angle < 2 * config::PI; angle += 0.1) {
-      int x = static_cast<int>(round(config::WIDTH / 2 + config::RADIUS * std::cos(angle)));
-      int y = static_cast<int>(round(config::HEIGHT / 2 + config::RADIUS * std::sin(angle)));
+      int x = static_cast<int>(round(config::WIDTH / 2 + config::RADIUS * dpp::cos(angle)));
+      int y = static_cast<int>(round(config::HEIGHT / 2 + config::RADIUS * dpp::sin(angle)));
 
       if (x >= 0 && x < config::WIDTH && y >= 0 && y < config::HEIGHT) {
         buffer[y][x] = config::CLOCK_BORDER;
@@ -66,8 +66,8 @@ class TerminalClock {
     // Draw hour markers at each multiple of 30 degrees (for 12-hour markers)
     for (int i{}; i < 12; ++i) {
       D const angle = i * config::PI / 6;
-      int x = static_cast<int>(round(config::WIDTH / 2 + (config::RADIUS - 1) * std::cos(angle)));
-      int y = static_cast<int>(round(config::HEIGHT / 2 + (config::RADIUS - 1) * std::sin(angle)));
+      int x = static_cast<int>(round(config::WIDTH / 2 + (config::RADIUS - 1) * dpp::cos(angle)));
+      int y = static_cast<int>(round(config::HEIGHT / 2 + (config::RADIUS - 1) * dpp::sin(angle)));
 
       if (x >= 0 && x < config::WIDTH && y >= 0 && y < config::HEIGHT) {
         auto const str(std::to_string(i + 3 > 12 ? i - 9 : i + 3));
@@ -83,8 +83,8 @@ class TerminalClock {
     D length = config::RADIUS * length_factor;
 
     for (D t{}; t < length; t += 0.5) {
-      int x = static_cast<int>(round(x_start + t * std::cos(angle)));
-      int y = static_cast<int>(round(y_start + t * std::sin(angle)));
+      int x = static_cast<int>(round(x_start + t * dpp::cos(angle)));
+      int y = static_cast<int>(round(y_start + t * dpp::sin(angle)));
 
       if (x >= 0 && x < config::WIDTH && y >= 0 && y < config::HEIGHT) {
         buffer[y][x] = symbol;
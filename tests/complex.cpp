@@ -0,0 +1,191 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../complex.hpp"
+
+using namespace dpp::literals;
+
+static constexpr auto max_iter = 100u;
+
+template <typename D>
+constexpr auto mandelbrot(D const cr, D const ci) noexcept
+{ // the hand-rolled loop of mandelbrot.cpp
+  auto zr(cr), zi(ci);
+
+  unsigned j{};
+
+  for (; max_iter != j; ++j)
+  {
+    if (auto const zr2(zr * zr), zi2(zi * zi); zr2 + zi2 <= 4)
+    {
+      zi = fma(zr + zr, zi, ci); // zi = 2 * zr * zi + ci;
+      zr = zr2 - zi2 + cr;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return j;
+}
+
+template <dpp::rounding R>
+auto exact() noexcept
+{ // fma() and * against the exact components in __int128, rounded by the
+  // constructor
+  using D = dpp::rounded_t<dpp::d32, R>;
+  using C = dpp::complex<D>;
+
+  std::mt19937_64 g;
+  std::uniform_int_distribution<std::int32_t> m(D::mmin, D::mmax), k(0, 9);
+  std::uniform_int_distribution<int> e(-4, 4);
+
+  auto const r([&]() noexcept
+    { // short significands and ones near mmax cancel more often
+      switch (k(g))
+      {
+        case 0: return D(dpp::direct, k(g), e(g));
+        case 1: return D(dpp::direct, D::mmax - k(g), e(g));
+        default: return D(dpp::direct, m(g), e(g));
+      }
+    }
+  );
+
+  auto const p([](D const& a, D const& b) noexcept
+    { // a * b * 10^8
+      return __int128(a.sig()) * b.sig() *
+        dpp::detail::pow(__int128(10), a.exp() + b.exp() + 8);
+    }
+  );
+
+  auto const q([](D const& a, __int128 const x) noexcept
+    { // a == x * 10^-8, rounded by the constructor, or with the fewest
+      // digits cut, normalize() may cut one more near mmax
+      if (a == D(x, -8)) return true;
+      else if ((x >= D::mmin) && (x <= D::mmax))
+        return a == D(dpp::direct, std::int32_t(x), -8);
+
+      for (int k(1);; ++k)
+      {
+        auto const f(dpp::detail::pow(__int128(10), k - 1));
+
+        if (auto const m(dpp::detail::round10<R>(x / f, x % f));
+          (m >= D::mmin) && (m <= D::mmax))
+          return a == D(dpp::direct, std::int32_t(m), k - 8);
+      }
+    }
+  );
+
+  std::size_t d{};
+
+  for (int i{}; 100000 != i; ++i)
+  {
+    C a(r(), r()), b(r(), r());
+    C const c(r(), r());
+
+    if (auto const j(k(g)); !j) b = {a.i_, a.r_}; // the products cancel
+    else if (1 == j) b = {a.i_ + r(), a.r_}; // almost
+
+    auto const x(p(a.r_, b.r_) - p(a.i_, b.i_)),
+      y(p(a.r_, b.i_) + p(a.i_, b.r_));
+
+    auto const u(a * b), v(fma(a, b, c));
+
+    d += !q(u.r_, x) || !q(u.i_, y) ||
+      !q(v.r_, x + p(c.r_, 1)) || !q(v.i_, y + p(c.i_, 1));
+  }
+
+  return d;
+}
+
+template <typename D>
+void run(char const* const n)
+{
+  constexpr int w(400), h(300);
+
+  std::vector<D> cr, ci;
+
+  for (int y{}; h != y; ++y)
+    for (int x{}; w != x; ++x)
+      cr.emplace_back(D(3 * x) / w - 2), ci.emplace_back(D(2 * y) / h - 1);
+
+  std::vector<unsigned> j(cr.size());
+
+  auto const t0(std::chrono::steady_clock::now());
+
+  std::size_t a{};
+
+  for (std::size_t i{}; cr.size() != i; ++i) a += mandelbrot(cr[i], ci[i]);
+
+  auto const t1(std::chrono::steady_clock::now());
+
+  std::size_t b{};
+
+  for (std::size_t i{}; cr.size() != i; ++i)
+  {
+    dpp::complex<D> const c(cr[i], ci[i]);
+
+    b += dpp::escape_time(c, c, max_iter);
+  }
+
+  auto const t2(std::chrono::steady_clock::now());
+
+  dpp::mandelbrot(cr.data(), ci.data(), j.data(), j.size(), max_iter);
+
+  auto const t3(std::chrono::steady_clock::now());
+
+  std::size_t c{};
+
+  for (auto const k: j) c += k;
+
+  std::cout << n << " loop: " <<
+    std::chrono::duration<double>(t1 - t0).count() << "s fused: " <<
+    std::chrono::duration<double>(t2 - t1).count() << "s batch: " <<
+    std::chrono::duration<double>(t3 - t2).count() << "s iterations: " <<
+    a << ' ' << b << ' ' << c << std::endl;
+}
+
+int main()
+{
+  using C = dpp::complex<dpp::d64>;
+
+  C const a(1.5_d64, -2_d64), b(.25_d64, 3_d64);
+
+  std::cout << a + b << ' ' << a - b << ' ' << a * b << ' ' << a / b <<
+    ' ' << a * b / b << ' ' << fma(a, a, b) << ' ' << norm(a) << ' ' <<
+    abs(a) << ' ' << conj(a) << ' ' << (a * a + b == fma(a, a, b)) <<
+    std::endl;
+
+  // rounded once: (1 + 10^-9 i)^2 = 1 - 10^-18 + 2 * 10^-9 i
+  using D = dpp::complex<dpp::d32>;
+
+  D const z(1_d32, dpp::d32(dpp::direct, 1, -9));
+
+  std::cout << z * z << ' ' << z * z - D(1_d32) << ' ' <<
+    C(dpp::nan) * a << ' ' << a / C{} << std::endl;
+
+  // the sticky digit of the cut product must not cancel with the other
+  {
+    using F = dpp::complex<dpp::rounded_t<dpp::d32, dpp::rounding::floor>>;
+
+    D const u(2147483647_d32, 2147483647_d32),
+      v(2147483647_d32, 2147483650_d32);
+    F const x(u.r_, u.i_), y(v.r_, v.i_);
+
+    std::cout << (u * v).r_ << ' ' << (x * y).r_ << ' ' <<
+      exact<dpp::rounding::half_up>() << ' ' <<
+      exact<dpp::rounding::half_even>() << ' ' <<
+      exact<dpp::rounding::half_down>() << ' ' <<
+      exact<dpp::rounding::toward_zero>() << ' ' <<
+      exact<dpp::rounding::floor>() << ' ' <<
+      exact<dpp::rounding::ceil>() << std::endl;
+  }
+
+  run<dpp::d32>("d32");
+  run<dpp::d64>("d64");
+
+  return 0;
+}
@@ -1,6 +1,6 @@
 #include <iostream>
 
-#include "../dpp.hpp"
+#include "../numbers.hpp"
 
 using namespace dpp::literals;
 
@@ -25,6 +25,9 @@ int main()
   test<.1_d32 + .2_d16>();
   test<dpp::d32::eps>();
   test<dpp::d64::eps>();
+  test<dpp::numbers::pi_v<dpp::d32>>();
+  test<dpp::numbers::e_v<dpp::d64>>();
+  test<dpp::numbers::ln2_v<dpp::d16>>();
 
   return 0;
 }
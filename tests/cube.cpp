@@ -9,7 +9,7 @@
 #include <thread>
 #include <vector>
 
-#include "../dpp.hpp"
+#include "../trig.hpp"
 
 using namespace dpp::literals;
 using namespace std::chrono_literals;
@@ -36,8 +36,8 @@ inline Vec3 operator*(const Mat3& m, const Vec3& v) noexcept {
 }
 
 Mat3 rotationMatrix(D const ax, D const ay) noexcept {
-    const D cx = std::cos(ax), sx = std::sin(ax);
-    const D cy = std::cos(ay), sy = std::sin(ay);
+    const auto [sx, cx] = dpp::sincos(ax);
+    const auto [sy, cy] = dpp::sincos(ay);
     return {  cy,  sx*sy,  cx*sy,
               0,    cx,   -sx,
              -sy,  sx*cy,  cx*cy };
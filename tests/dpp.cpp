@@ -238,11 +238,22 @@ int main()
   std::cout << a / b << std::endl;
   std::cout << b / a << std::endl;
 
+  {
+    char s[32];
+
+    auto const r(dpp::to_chars(s, s + sizeof(s), a / b));
+    std::cout << std::string(s, r.ptr) << std::endl;
+  }
+
   //
   std::cout << dpp::ceil(b) << std::endl;
   std::cout << dpp::floor(b) << std::endl;
   std::cout << dpp::round(b) << std::endl;
 
+  std::cout << dpp::quantize(1.005_d64, -2) << ' ' <<
+    dpp::quantize(1.005_d64, -2, dpp::rounding::half_even) << ' ' <<
+    dpp::quantize(-1.005_d64, -2, dpp::rounding::floor) << std::endl;
+
   //
   std::cout << (dpp::d32(dpp::nan) != dpp::d64(dpp::nan)) << std::endl;
 
@@ -0,0 +1,679 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+
+#include "../exp.hpp"
+
+using namespace dpp::literals;
+
+struct ref_t
+{ // x = m * 10^e, ln(x), log10(x), log2(x), ln(1 + x), 40 digits,
+  // truncated, "..." if inexact
+  std::int64_t m;
+  int e;
+  char const* r[4];
+};
+
+// generated with Python's decimal module, 60 digits of precision, from
+//   x = Decimal(m).scaleb(e)
+//   (x.ln(), x.log10(), x.ln() / Decimal(2).ln(), (x + 1).ln())
+// or x - x^2 / 2 + x^3 / 3 - ..., to 60 - x.adjusted() digits, for ln(1 + x),
+// if |x| <= 1e-10
+constexpr ref_t d16_refs[]{
+  {1, 0, {"0",
+    "0",
+    "0",
+    "6.931471805599453094172321214581765680755...e-1"}},
+  {2, 0, {"6.931471805599453094172321214581765680755...e-1",
+    "3.010299956639811952137388947244930267681...e-1",
+    "1e+0",
+    "1.098612288668109691395245236922525704647...e+0"}},
+  {10, 0, {"2.302585092994045684017991454684364207601...e+0",
+    "1e+0",
+    "3.321928094887362347870319429489390175864...e+0",
+    "2.397895272798370544061943577965129299821...e+0"}},
+  {5, -1, {"-6.931471805599453094172321214581765680755...e-1",
+    "-3.010299956639811952137388947244930267681...e-1",
+    "-1e+0",
+    "4.054651081081643819780131154643491365719...e-1"}},
+  {315, -3, {"-1.155182640156503989557371813538673844345...e+0",
+    "-5.016894462103994899114668296216262148843...e-1",
+    "-1.666576266274808225391191653851316525569...e+0",
+    "2.738366656297278736327112333781671071077...e-1"}},
+  {32767, 0, {"1.039717719035538387983075336747001323034...e+1",
+    "4.515436681141698947247993414048354704233...e+0",
+    "1.499995597176955822279099420087832124074...e+1",
+    "1.039720770839917964125848182187264852113...e+1"}},
+  {32767, 122, {"2.913125585356289573300257108389624465576...e+2",
+    "1.265154366811416989472479934140483547042...e+2",
+    "4.202751835480277646629699645985839226962...e+2",
+    "2.913125585356289573300257108389624465576...e+2"}},
+  {1, -127, {"-2.924283068102438018702849147449142543653...e+2",
+    "-1.27e+2",
+    "-4.218848680506950181795305675451525523348...e+2",
+    "9.999999999999999999999999999999999999999...e-128"}},
+  {10001, -4, {"9.999500033330833533316668095113106348206...e-5",
+    "4.342727686266963731352758509826813109796...e-5",
+    "1.442622910945541783910709000574797010247...e-4",
+    "6.931971793099869745214612855207881703357...e-1"}},
+  {9999, -4, {"-1.000050003333583353335000142869643968353...e-4",
+    "-4.343161980751038455604402380722667375072...e-5",
+    "-1.442767180450352027776698458252274416136...e-4",
+    "6.930971793099036411880029521872316227162...e-1"}},
+  {10007, -4, {"6.997551142733419277369243651463278217048...e-4",
+    "3.038997848124918105176677363847244183182...e-4",
+    "1.009533233198840294072062712092995278915...e-3",
+    "6.934971193242332255715300024058181302282...e-1"}},
+  {99, -2, {"-1.005033585350144118354885755854770608551...e-2",
+    "-4.364805402450084659744222246745139893040...e-3",
+    "-1.449956969511507663379792435735437550680...e-2",
+    "6.881346387364010273741383824998087866889...e-1"}},
+  {101, -2, {"9.950330853168082848215357544260741688679...e-3",
+    "4.321373782642574275188178222937913219289...e-3",
+    "1.435529297707004143102025451152914806518...e-2",
+    "6.981347220709843830293343239175200400122...e-1"}},
+  {-5, -1, {"",
+    "",
+    "",
+    "-6.931471805599453094172321214581765680755...e-1"}},
+  {-1, -3, {"",
+    "",
+    "",
+    "-1.000500333583533500142982254068344960755...e-3"}},
+  {-9999, -4, {"",
+    "",
+    "",
+    "-9.210340371976182736071965818737456830404...e+0"}},
+  {-2, -2, {"",
+    "",
+    "",
+    "-2.020270731751944840804530102419238785253...e-2"}},
+  {1024, 0, {"6.931471805599453094172321214581765680755...e+0",
+    "3.010299956639811952137388947244930267681...e+0",
+    "1e+1",
+    "6.932447891572508553068282039489782867427...e+0"}},
+  {125, -3, {"-2.079441541679835928251696364374529704226...e+0",
+    "-9.030899869919435856412166841734790803045...e-1",
+    "-3e+0",
+    "1.177830356563834545387941094705217050684...e-1"}},
+  {1600, -2, {"2.772588722239781237668928485832706272302...e+0",
+    "1.204119982655924780854955578897972107072...e+0",
+    "4e+0",
+    "2.833213344056216080249534617873126535588...e+0"}},
+  {1000, 0, {"6.907755278982137052053974364053092622803...e+0",
+    "3e+0",
+    "9.965784284662087043610958288468170527594...e+0",
+    "6.908754779315220585220783762973627634264...e+0"}},
+  {1, -5, {"-1.151292546497022842008995727342182103800...e+1",
+    "-5e+0",
+    "-1.660964047443681173935159714744695087932...e+1",
+    "9.999950000333330833353333166668095225595...e-6"}},
+  {1, -30, {"-6.907755278982137052053974364053092622803...e+1",
+    "-3e+1",
+    "-9.965784284662087043610958288468170527594...e+1",
+    "9.999999999999999999999999999995000000000...e-31"}},
+  {20412, -9, {"-1.079938759476254908385063468426459077473...e+1",
+    "-4.690114440339806155090138532427685897779...e+0",
+    "-1.558022292760171993466847188448578172158...e+1",
+    "2.041179167796284145963238655922577338364...e-5"}},
+  {24307, -6, {"-3.716990904275011645094527066173843567847...e+0",
+    "-1.614268639011215691324310476145771868904...e+0",
+    "-5.362484344626942995710276512010779671105...e+0",
+    "2.401628637237113270121592131583934915468...e-2"}},
+  {26057, 5, {"2.168096719006611411303884374509328430029...e+1",
+    "9.415924412971164624080358528042338282865...e+0",
+    "3.127902384678470657109504375525593511683...e+1",
+    "2.168096719044988814681407227605412372038...e+1"}},
+  {30883, 9, {"3.106122698662541018683341547921498662240...e+1",
+    "1.348971948143578650325890067290941510335...e+1",
+    "4.481187813753091979332061210527113799775...e+1",
+    "3.106122698662544256710735259619875967008...e+1"}},
+  {24245, 3, {"1.700372096852158970404395574394626300505...e+1",
+    "7.384622188451543179499663201919275318992...e+0",
+    "2.453118391794577932891363387557413783249...e+1",
+    "1.700372100976720650656784687633630434107...e+1"}},
+  {30223, -1, {"8.013773409910839949993326500991445776307...e+0",
+    "3.480337571147283971240403394985567857679...e+0",
+    "1.156143115728620695437392286244229552553...e+1",
+    "8.014104229021968740190285710812186076387...e+0"}},
+  {951, 9, {"2.758077989949180146175693049838041488243...e+1",
+    "1.197818051693741393184825691963334018968...e+1",
+    "3.979065438484682456663782611875715905487...e+1",
+    "2.758077989949285298646776065004986239559...e+1"}},
+  {15258, 7, {"2.575095488560849442493787258442649336430...e+1",
+    "1.118349761055935251965742684307860926028...e+1",
+    "3.715077491162279888660774778053411338956...e+1",
+    "2.575095488561504836385514039823263682788...e+1"}},
+  {30912, -10, {"-1.268695119292821229636917100591868111483...e+1",
+    "-5.509872895264600681842545357554100787009...e+0",
+    "-1.830340157003785031751333778955158559674...e+1",
+    "3.091195222251125982343254063523017026737...e-6"}},
+  {21266, -16, {"-2.687649665569369947362540859861975435418...e+1",
+    "-1.167231419045897563298290822937918267047...e+1",
+    "-3.877458844163811003479307932095919596436...e+1",
+    "2.126599999997738786220003205798149693553...e-12"}},
+  {29521, -12, {"-1.733816396244914235216000138033853095660...e+1",
+    "-7.529868935225482053923574209473356444637...e+0",
+    "-2.501368316674511723713901006075471049693...e+1",
+    "2.952099956425528807574640604687637391366...e-8"}},
+  {3710, -6, {"-5.596723402362793280840135390949583538008...e+0",
+    "-2.430626090384954123654791449780107213820...e+0",
+    "-8.074365097816008452628849811675032427521...e+0",
+    "3.703134924381193472260829911289436853196...e-3"}},
+  {15371, 10, {"3.266608882616538898962419444141808079163...e+1",
+    "1.418670212256510126585996202163735083264...e+1",
+    "4.712720435474718654303138332666309807926...e+1",
+    "3.266608882616539549538178991338963190218...e+1"}},
+  {8080, -5, {"-2.515778313455087356936071187449937969287...e+0",
+    "-1.092588639225413840083595137603583006476...e+0",
+    "-3.629500896797654654309618604467251203664...e+0",
+    "7.770150766385204914001434246331136764924...e-2"}},
+  {17818, -14, {"-2.244822684063605048742236157091874842401...e+1",
+    "-9.749141045400705177656531665403059945858...e+0",
+    "-3.238594553973615270483416379644812322336...e+1",
+    "1.781799999841259438018856262222253476731...e-10"}},
+  {18807, -10, {"-1.318386650999837862931855271801505318681...e+1",
+    "-5.725680475441378678325938248107304887517...e+0",
+    "-1.902029883371674615146643176503654201639...e+1",
+    "1.880698231485972362540335996900370836740...e-6"}},
+  {430, 6, {"1.987929576665188221159878269613639648876...e+1",
+    "8.633468455579586526405088153229222158808...e+0",
+    "2.867976141891363437397637764689379866302...e+1",
+    "1.987929576897746360424345549643490269264...e+1"}},
+  {7102, -4, {"-3.422086584731495328401925618864997414019...e-1",
+    "-1.486193320344033250041371844221817995866...e-1",
+    "-4.937027345284777792712226906496559847158...e-1",
+    "5.366103227397178600135620362294563050850...e-1"}},
+  {9159, -12, {"-1.850852883452556067201835517343096365424...e+1",
+    "-8.038151940981675750207054508480233396720...e+0",
+    "-2.670216276372041199269920577783077251925...e+1",
+    "9.158999958056359756107867133731034497275...e-9"}},
+  {30027, 10, {"3.333570318582758536065662037686680667129...e+1",
+    "1.447751194396957256832389212650968403691...e+1",
+    "4.809325367073987598580830409279405884621...e+1",
+    "3.333570318582758869099265128237962790546...e+1"}},
+};
+
+constexpr ref_t d32_refs[]{
+  {1, 0, {"0",
+    "0",
+    "0",
+    "6.931471805599453094172321214581765680755...e-1"}},
+  {2, 0, {"6.931471805599453094172321214581765680755...e-1",
+    "3.010299956639811952137388947244930267681...e-1",
+    "1e+0",
+    "1.098612288668109691395245236922525704647...e+0"}},
+  {10, 0, {"2.302585092994045684017991454684364207601...e+0",
+    "1e+0",
+    "3.321928094887362347870319429489390175864...e+0",
+    "2.397895272798370544061943577965129299821...e+0"}},
+  {5, -1, {"-6.931471805599453094172321214581765680755...e-1",
+    "-3.010299956639811952137388947244930267681...e-1",
+    "-1e+0",
+    "4.054651081081643819780131154643491365719...e-1"}},
+  {315, -3, {"-1.155182640156503989557371813538673844345...e+0",
+    "-5.016894462103994899114668296216262148843...e-1",
+    "-1.666576266274808225391191653851316525569...e+0",
+    "2.738366656297278736327112333781671071077...e-1"}},
+  {3149999, -6, {"1.147402135377173843605913656664422990173...e+0",
+    "4.983104159183145294858457603562849074754...e-1",
+    "1.655351370614055745264933384737743314826...e+0",
+    "1.423108093278722476559028075242517588389...e+0"}},
+  {2147483647, 0, {"2.148756259689264330451803629010876510163...e+1",
+    "9.331929865381182924065103517284771286321...e+0",
+    "3.099999999932819276991073646469478216008...e+1",
+    "2.148756259735830459193419576520347361034...e+1"}},
+  {2147483647, 32757, {"7.544726745380284711468186411738582711349...e+4",
+    "3.276633192986538118292406510351728477128...e+4",
+    "1.088473986042246566219579642882486487729...e+5",
+    "7.544726745380284711468186411738582711349...e+4"}},
+  {1, -32767, {"-7.544880574213589492821752599564256199046...e+4",
+    "-3.2767e+4",
+    "-1.088496178851742020526667567460788478925...e+5",
+    "9.999999999999999999999999999999999999999...e-32768"}},
+  {1000000001, -9, {"9.999999995000000003333333330833333335333...e-10",
+    "4.342944816861045868442678322835509449975...e-10",
+    "1.442695040167615887396341323924243839445...e-9",
+    "6.931471810599453092922321214998432347265...e-1"}},
+  {999999999, -9, {"-1.000000000500000000333333333583333333533...e-9",
+    "-4.342944821203990687475196601518271048657...e-10",
+    "-1.442695041610310928285304732005516040891...e-9",
+    "6.931471800599453092922321214165099013932...e-1"}},
+  {1000000007, -9, {"6.999999975500000114333332733083336694733...e-9",
+    "3.040061362682548036582568158550108054793...e-9",
+    "1.009886525087671551468800142902221307479...e-8",
+    "6.931471840599453032922321357498431972265...e-1"}},
+  {99, -2, {"-1.005033585350144118354885755854770608551...e-2",
+    "-4.364805402450084659744222246745139893040...e-3",
+    "-1.449956969511507663379792435735437550680...e-2",
+    "6.881346387364010273741383824998087866889...e-1"}},
+  {101, -2, {"9.950330853168082848215357544260741688679...e-3",
+    "4.321373782642574275188178222937913219289...e-3",
+    "1.435529297707004143102025451152914806518...e-2",
+    "6.981347220709843830293343239175200400122...e-1"}},
+  {-5, -1, {"",
+    "",
+    "",
+    "-6.931471805599453094172321214581765680755...e-1"}},
+  {-1, -3, {"",
+    "",
+    "",
+    "-1.000500333583533500142982254068344960755...e-3"}},
+  {-999999999, -9, {"",
+    "",
+    "",
+    "-2.072326583694641115616192309215927786840...e+1"}},
+  {-2, -2, {"",
+    "",
+    "",
+    "-2.020270731751944840804530102419238785253...e-2"}},
+  {1024, 0, {"6.931471805599453094172321214581765680755...e+0",
+    "3.010299956639811952137388947244930267681...e+0",
+    "1e+1",
+    "6.932447891572508553068282039489782867427...e+0"}},
+  {125, -3, {"-2.079441541679835928251696364374529704226...e+0",
+    "-9.030899869919435856412166841734790803045...e-1",
+    "-3e+0",
+    "1.177830356563834545387941094705217050684...e-1"}},
+  {9765625, -10, {"-6.931471805599453094172321214581765680755...e+0",
+    "-3.010299956639811952137388947244930267681...e+0",
+    "-1e+1",
+    "9.760859730554588959608249080171866726118...e-4"}},
+  {1600, -2, {"2.772588722239781237668928485832706272302...e+0",
+    "1.204119982655924780854955578897972107072...e+0",
+    "4e+0",
+    "2.833213344056216080249534617873126535588...e+0"}},
+  {1000, 0, {"6.907755278982137052053974364053092622803...e+0",
+    "3e+0",
+    "9.965784284662087043610958288468170527594...e+0",
+    "6.908754779315220585220783762973627634264...e+0"}},
+  {1, -5, {"-1.151292546497022842008995727342182103800...e+1",
+    "-5e+0",
+    "-1.660964047443681173935159714744695087932...e+1",
+    "9.999950000333330833353333166668095225595...e-6"}},
+  {1, -30, {"-6.907755278982137052053974364053092622803...e+1",
+    "-3e+1",
+    "-9.965784284662087043610958288468170527594...e+1",
+    "9.999999999999999999999999999995000000000...e-31"}},
+  {1227077738, -20, {"-2.512380050305942521405822469659309229050...e+1",
+    "-1.091112792291685070742850857318977948304...e+1",
+    "-3.624598239404747688260343548435010369586...e+1",
+    "1.227077737992471401124585604620522289289...e-11"}},
+  {921032233, 8, {"3.906168633538798405171049137543948550983...e+1",
+    "1.696427482929465604094820995732653470013...e+1",
+    "5.635410116482443084893294138644003540565...e+1",
+    "3.906168633538798406256787469136085125612...e+1"}},
+  {1241441629, -22, {"-2.971733290057410403182236022524238578647...e+1",
+    "-1.290607369560129036790088307848397435320...e+1",
+    "-4.287304880410469455209767059861788292484...e+1",
+    "1.241441628999922941134089297695555601671...e-13"}},
+  {442592577, 7, {"3.602625586504779540003662852200775622949...e+1",
+    "1.564600412582491979698471863638201040813...e+1",
+    "5.197490067830138695478101885359848340571...e+1",
+    "3.602625586504779562597805907609494938847...e+1"}},
+  {1746594093, 9, {"4.200419933288528587881381006028051421808...e+1",
+    "1.824219198703633127972703708879715976515...e+1",
+    "6.059925007406510698873390377809673962808...e+1",
+    "4.200419933288528587938635293329708979843...e+1"}},
+  {1768643644, -5, {"9.780553321976969680119851775379794505947...e+0",
+    "4.247640337695116604695405271022432899238...e+0",
+    "1.411035577476625115870937423868522450498...e+1",
+    "9.780609860880903593239337331820358334237...e+0"}},
+  {1403321571, -12, {"-6.568913301701297199953955518417210478695...e+0",
+    "-2.852842799029744229924264656490155526693...e+0",
+    "-9.476938644394008583271777934635692187719...e+0",
+    "1.402337835508127374348698742327013231873...e-3"}},
+  {73881117, 11, {"4.344640385522759685048610931612816385458...e+1",
+    "1.886853345286551199816247977224673829073...e+1",
+    "6.267991138639599525599442380417866488675...e+1",
+    "4.344640385522759685062146189884561248221...e+1"}},
+  {1052450781, -2, {"1.616921717254376723249761841944540998856...e+1",
+    "7.022201794731057802810536412711521352143...e+0",
+    "2.332724942988555956128595541404070829146...e+1",
+    "1.616921726756008253625747191341648925370...e+1"}},
+  {163400636, -7, {"2.793619981713143577334079719380201918765...e+0",
+    "1.213253742592681535041897800037878967004...e+0",
+    "4.030341693745868879640219826060095615453...e+0",
+    "2.853019639165738561845349698769868387782...e+0"}},
+  {2045261764, 1, {"2.374137671319966077543601213729137804662...e+1",
+    "1.031074889932897443299558600392503245379...e+1",
+    "3.425156644800986826878562830207006774403...e+1",
+    "2.374137671324855427247278328241907885675...e+1"}},
+  {95684111, 4, {"2.758690318535688416115965442102056973157...e+1",
+    "1.198083982619973552795630818784978120854...e+1",
+    "3.979948841899832486332280966494892976963...e+1",
+    "2.758690318535792926675717570378318142522...e+1"}},
+  {1847181762, -14, {"-1.089926435928260575537708687255675479683...e+1",
+    "-4.733490368041217251433929179719985205819...e+0",
+    "-1.572431464047484046410242809649465015122...e+1",
+    "1.847164701807778855667665603237466696840...e-5"}},
+  {1295341973, 0, {"2.098204056905175942993013914305100009414...e+1",
+    "9.112384438209345015604500400429016931851...e+0",
+    "3.027068587670201711046186436894931645701...e+1",
+    "2.098204056982375633920808897862750080086...e+1"}},
+  {819492613, 4, {"2.973453631405076765783993341690348965422...e+1",
+    "1.291354504314410541763839760671950004609...e+1",
+    "4.289786808341383952616407494014961434985...e+1",
+    "2.973453631405088968456526766210511630181...e+1"}},
+  {609065480, -6, {"6.411925782455431189719928906080515934282...e+0",
+    "2.784663985693584075936892130714156867897...e+0",
+    "9.250453528896536989780771699880556267604...e+0",
+    "6.413566295668668959528641610975745497472...e+0"}},
+  {981037431, -11, {"-4.624314850169482836135667509975816222988...e+0",
+    "-2.008314422011869150407789527339050696871...e+0",
+    "-6.671476101848702732969823320470010033676...e+0",
+    "9.762565018346188116833548872746053738177...e-3"}},
+  {1472876336, -3, {"1.420272773808473736563175194271530871373...e+1",
+    "6.168166284624454735284772211170328540426...e+0",
+    "2.049020487483097494095271902800482108776...e+1",
+    "1.420272841702813273860264825318140747453...e+1"}},
+  {1421304154, 1, {"2.337742579837543790078120113265614968677...e+1",
+    "1.015268702533717402442876714341853166586...e+1",
+    "3.372649626806596041031268786384647680601...e+1",
+    "2.337742579844579581799058269627294903216...e+1"}},
+  {285568390, 7, {"3.558808775399091196252978236059979017167...e+1",
+    "1.545571013304694409588461415445619697288...e+1",
+    "5.134275771740393664463015294148686338975...e+1",
+    "3.558808775399091231270859591906115380880...e+1"}},
+};
+
+constexpr ref_t d64_refs[]{
+  {1, 0, {"0",
+    "0",
+    "0",
+    "6.931471805599453094172321214581765680755...e-1"}},
+  {2, 0, {"6.931471805599453094172321214581765680755...e-1",
+    "3.010299956639811952137388947244930267681...e-1",
+    "1e+0",
+    "1.098612288668109691395245236922525704647...e+0"}},
+  {10, 0, {"2.302585092994045684017991454684364207601...e+0",
+    "1e+0",
+    "3.321928094887362347870319429489390175864...e+0",
+    "2.397895272798370544061943577965129299821...e+0"}},
+  {5, -1, {"-6.931471805599453094172321214581765680755...e-1",
+    "-3.010299956639811952137388947244930267681...e-1",
+    "-1e+0",
+    "4.054651081081643819780131154643491365719...e-1"}},
+  {315, -3, {"-1.155182640156503989557371813538673844345...e+0",
+    "-5.016894462103994899114668296216262148843...e-1",
+    "-1.666576266274808225391191653851316525569...e+0",
+    "2.738366656297278736327112333781671071077...e-1"}},
+  {3149999, -6, {"1.147402135377173843605913656664422990173...e+0",
+    "4.983104159183145294858457603562849074754...e-1",
+    "1.655351370614055745264933384737743314826...e+0",
+    "1.423108093278722476559028075242517588389...e+0"}},
+  {9223372036854775807, 0, {"4.366827237527655449317720343461657334534...e+1",
+    "1.896488972683081529841846406556526346419...e+1",
+    "6.299999999999999999984358269024341222235...e+1",
+    "4.366827237527655449328562365186512378875...e+1"}},
+  {9223372036854775807, 32748, {"7.544872489774428461471436136143817564386...e+4",
+    "3.276696488972683081529841846406556526346...e+4",
+    "1.088495012513713421680570642596087928914...e+5",
+    "7.544872489774428461471436136143817564386...e+4"}},
+  {1, -32767, {"-7.544880574213589492821752599564256199046...e+4",
+    "-3.2767e+4",
+    "-1.088496178851742020526667567460788478925...e+5",
+    "9.999999999999999999999999999999999999999...e-32768"}},
+  {1000000000000000001, -18, {"9.999999999999999995000000000000000003333...e-19",
+    "4.342944819032518274339816779649791686135...e-19",
+    "1.442695040888963406638577160557410434227...e-18",
+    "6.931471805599453099172321214581765679505...e-1"}},
+  {999999999999999999, -18, {"-1.000000000000000000500000000000000000333...e-18",
+    "-4.342944819032518278682761598682309962647...e-19",
+    "-1.442695040888963408081272201446373841587...e-18",
+    "6.931471805599453089172321214581765679505...e-1"}},
+  {1000000000000000007, -18, {"6.999999999999999975500000000000000114333...e-18",
+    "3.040061373322762782917687625786565848262...e-18",
+    "1.009886528622274381617344426523364164661...e-17",
+    "6.931471805599453129172321214581765619505...e-1"}},
+  {99, -2, {"-1.005033585350144118354885755854770608551...e-2",
+    "-4.364805402450084659744222246745139893040...e-3",
+    "-1.449956969511507663379792435735437550680...e-2",
+    "6.881346387364010273741383824998087866889...e-1"}},
+  {101, -2, {"9.950330853168082848215357544260741688679...e-3",
+    "4.321373782642574275188178222937913219289...e-3",
+    "1.435529297707004143102025451152914806518...e-2",
+    "6.981347220709843830293343239175200400122...e-1"}},
+  {-5, -1, {"",
+    "",
+    "",
+    "-6.931471805599453094172321214581765680755...e-1"}},
+  {-1, -3, {"",
+    "",
+    "",
+    "-1.000500333583533500142982254068344960755...e-3"}},
+  {-999999999999999999, -18, {"",
+    "",
+    "",
+    "-4.144653167389282231232384618431855573681...e+1"}},
+  {-2, -2, {"",
+    "",
+    "",
+    "-2.020270731751944840804530102419238785253...e-2"}},
+  {1024, 0, {"6.931471805599453094172321214581765680755...e+0",
+    "3.010299956639811952137388947244930267681...e+0",
+    "1e+1",
+    "6.932447891572508553068282039489782867427...e+0"}},
+  {125, -3, {"-2.079441541679835928251696364374529704226...e+0",
+    "-9.030899869919435856412166841734790803045...e-1",
+    "-3e+0",
+    "1.177830356563834545387941094705217050684...e-1"}},
+  {9765625, -10, {"-6.931471805599453094172321214581765680755...e+0",
+    "-3.010299956639811952137388947244930267681...e+0",
+    "-1e+1",
+    "9.760859730554588959608249080171866726118...e-4"}},
+  {1600, -2, {"2.772588722239781237668928485832706272302...e+0",
+    "1.204119982655924780854955578897972107072...e+0",
+    "4e+0",
+    "2.833213344056216080249534617873126535588...e+0"}},
+  {1000, 0, {"6.907755278982137052053974364053092622803...e+0",
+    "3e+0",
+    "9.965784284662087043610958288468170527594...e+0",
+    "6.908754779315220585220783762973627634264...e+0"}},
+  {1, -5, {"-1.151292546497022842008995727342182103800...e+1",
+    "-5e+0",
+    "-1.660964047443681173935159714744695087932...e+1",
+    "9.999950000333330833353333166668095225595...e-6"}},
+  {1, -30, {"-6.907755278982137052053974364053092622803...e+1",
+    "-3e+1",
+    "-9.965784284662087043610958288468170527594...e+1",
+    "9.999999999999999999999999999995000000000...e-31"}},
+  {398945938642050648, 2, {"4.513277249648356653421384754567003415843...e+1",
+    "1.960091404821766409741675757370903921693...e+1",
+    "6.511282706224664210249463372274807445236...e+1",
+    "4.513277249648356653423891359856441486145...e+1"}},
+  {4717678252668579859, -19, {"-7.512683100379841502052024623398235264732...e-1",
+    "-3.262716814782778908977785924830247628464...e-1",
+    "-1.083851065268831981832559271029118772197...e+0",
+    "3.864642804661776247256241593130450475690...e-1"}},
+  {3202067333979746323, 2, {"4.721549850296005322356215635084032445209...e+1",
+    "2.050543046014679859471711314216977493730...e+1",
+    "6.811756554332074453315792583460419602899...e+1",
+    "4.721549850296005322356527933326292432983...e+1"}},
+  {5392961813720846895, -22, {"-7.525245636358038214854300148537712775127...e+0",
+    "-3.268172654836820811262395473114083305814...e+0",
+    "-1.085663456104505339881799950540674584744...e+1",
+    "5.391508134483593890352118017658843017067...e-4"}},
+  {2408024840701338838, -25, {"-1.523928880765908216393130699093776184420...e+1",
+    "-6.618339037296325380942363093384031379417...e+0",
+    "-2.198564638948444195305474503427694147127...e+1",
+    "2.408024550772203710034280417926710845446...e-7"}},
+  {3798798140915319565, -11, {"1.745278038895750640854353661050882019846...e+1",
+    "7.579646216793534160672237513797412566959...e+0",
+    "2.517903971687314838884611038129429246531...e+1",
+    "1.745278041528162129286305040645836874109...e+1"}},
+  {2471041371269454445, -25, {"-1.521345598136863169255325775077085694570...e+1",
+    "-6.607119983386417490658784322653005410241...e+0",
+    "-2.194837749910306302135107553624942468598...e+1",
+    "2.471041065967231813032531773604832377169...e-7"}},
+  {3002205164250005417, -12, {"1.491485763136195461597055733721012041084...e+1",
+    "6.477440367673101817772560640514687206885...e+0",
+    "2.151759114033080302942952645717779948773...e+1",
+    "1.491485796445039419488387305875520452581...e+1"}},
+  {5250312406644175252, 8, {"6.152549999870576869590923228184561793364...e+1",
+    "2.672018514577644280847646236693288440820...e+1",
+    "8.876253373634673703534803939421206204260...e+1",
+    "6.152549999870576869590923228375026650033...e+1"}},
+  {8108685934005720498, -27, {"-1.863033001227963898131576409543417389071...e+1",
+    "-8.091049520369589071593161449674125020045...e+0",
+    "-2.687788471884065589929088082648316659954...e+1",
+    "8.108685901130326887546382476235154969932...e-9"}},
+  {1868212727904689138, -24, {"-1.319052834460683196142477584062577132598...e+1",
+    "-5.728573673451182070691326071047513323618...e+0",
+    "-1.902990982946958424296035156096632245015...e+1",
+    "1.868210982797464272807630112943283084962...e-6"}},
+  {4202232653692109980, -7, {"2.676405199119539689271884606674613845008...e+1",
+    "1.162348009314790033950942232766969664731...e+1",
+    "3.861236508179198562080812823473578107343...e+1",
+    "2.676405199119777658009555569134302668569...e+1"}},
+  {6765072020363829451, -27, {"-1.881149292935463291330142212516488473256...e+1",
+    "-8.169727575580755335313620282562285382324...e+0",
+    "-2.713924756089772815704693710253172193318...e+1",
+    "6.765071997480729833849105275530464709224...e-9"}},
+  {908423481049567047, -5, {"2.983756158863739723534105811384485284767...e+1",
+    "1.295828835139364596710313040520673914304...e+1",
+    "4.304650213614619376708296521980151755234...e+1",
+    "2.983756158863750731615918542303411540356...e+1"}},
+  {916419590086274250, 6, {"5.517476128044784676738811304321091103404...e+1",
+    "2.396209436442769702618960791454973793054...e+1",
+    "7.960035448153450129812822314377170150060...e+1",
+    "5.517476128044784676738811413441412277011...e+1"}},
+  {3903145421351804772, -6, {"2.899280386229836990225283267928495189427...e+1",
+    "1.259141473229946910119662676778109012528...e+1",
+    "4.182777435360424296841218997269541304166...e+1",
+    "2.899280386229862610587633321865694806480...e+1"}},
+  {6071647078989666014, -12, {"1.561914047367237699652150367972576082599...e+1",
+    "6.783306519787656310924939218495796223225...e+0",
+    "2.253365650431523321340077482120855951302...e+1",
+    "1.561914063837231832058699048418198173393...e+1"}},
+  {8438402865438640933, 1, {"4.588190982363496252987438905944210110927...e+1",
+    "1.992626025558726648968881081924066515801...e+1",
+    "6.619360376907277410543497009099125564565...e+1",
+    "4.588190982363496252988623964320713705946...e+1"}},
+  {1462082149031370229, 9, {"6.254965906007619141754400837586834523943...e+1",
+    "2.716497177472083123710774395174538424400...e+1",
+    "9.024008293526734142742822475168283421076...e+1",
+    "6.254965906007619141754400837655230133633...e+1"}},
+  {3748314449756538438, -17, {"3.623891351864997623664164657138732185365...e+0",
+    "1.573836017131884011816641127207014216001...e+0",
+    "5.228170082056033625328149006982274078354...e+0",
+    "3.650220340170993522571233947421576315535...e+0"}},
+};
+
+template <typename D>
+D expected(std::string_view s) noexcept
+{ // s rounded once by the constructor: the digits that fit sig2_t, and a
+  // sticky digit, if any digit beyond them is nonzero, or if s is inexact
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  constexpr int L(dpp::detail::maxpow10e<U>());
+
+  if ("0" == s) return {};
+
+  bool const neg('-' == s.front());
+
+  if (neg) s.remove_prefix(1);
+
+  auto const p(s.find('e'));
+
+  U m{};
+  F e(std::atoi(s.data() + p + 1) + 1);
+  bool x(s.substr(0, p).ends_with("..."));
+
+  for (int n{}; auto const c: s.substr(0, p))
+  {
+    if (('0' > c) || ('9' < c)) continue;
+    else if (L > n++) m = U(10) * m + U(c - '0'), --e;
+    else x = x || ('0' != c);
+  }
+
+  if (x && !(m % U(10))) ++m;
+
+  return D(neg ? -m : m, e);
+}
+
+template <typename D, std::size_t N>
+std::size_t check(ref_t const (&refs)[N]) noexcept
+{ // log, log10, log2 and log1p against the references, correctly rounded
+  using T = typename D::sig_t;
+
+  std::size_t d{};
+
+  for (auto const& [m, e, r]: refs)
+  {
+    D const x(dpp::direct, T(m), e);
+
+    D const y[]{dpp::log(x), dpp::log10(x), dpp::log2(x), dpp::log1p(x)};
+
+    for (std::size_t i(m > 0 ? 0 : 3); 4 != i; ++i)
+    {
+      if (auto const z(expected<D>(r[i])); isnan(y[i]) || (y[i] != z))
+      {
+        ++d;
+
+        std::cout << "log" << (char const*[]){"", "10", "2", "1p"}[i] <<
+          '(' << x << ") = " << y[i] << ", expected " << z << std::endl;
+      }
+    }
+  }
+
+  return d;
+}
+
+template <typename D>
+using modes_t = std::tuple<
+  dpp::rounded_t<D, dpp::rounding::half_even>,
+  dpp::rounded_t<D, dpp::rounding::half_up>,
+  dpp::rounded_t<D, dpp::rounding::half_down>,
+  dpp::rounded_t<D, dpp::rounding::toward_zero>,
+  dpp::rounded_t<D, dpp::rounding::floor>,
+  dpp::rounded_t<D, dpp::rounding::ceil>
+>;
+
+template <typename ...D, std::size_t N>
+std::size_t check(std::tuple<D...>, ref_t const (&refs)[N]) noexcept
+{
+  return (check<D>(refs) + ...);
+}
+
+int main()
+{
+  std::cout << dpp::exp(1_d32) << ' ' << dpp::exp(1_d64) << std::endl;
+  std::cout << dpp::exp(1_d128) << std::endl;
+  std::cout << dpp::exp(-1000_d64) << ' ' << dpp::exp(1000_d64) <<
+    std::endl;
+
+  std::cout << dpp::log(10_d64) << ' ' << dpp::log(.5_d64) << ' ' <<
+    dpp::log(1.0001_d64) << std::endl;
+  std::cout << dpp::log(2_d128) << std::endl;
+  std::cout << dpp::log10(2_d64) << ' ' << dpp::log10(1000_d64) << ' ' <<
+    dpp::log2(1024_d64) << std::endl;
+
+  std::cout << dpp::expm1(.001_d64) << ' ' << dpp::log1p(.001_d64) <<
+    std::endl;
+  std::cout << dpp::log(0_d64) << ' ' << dpp::log(-1_d64) << ' ' <<
+    dpp::exp(dpp::d64(dpp::nan)) << std::endl;
+
+  // 5% a year, compounded daily, over 30 years
+  std::cout << dpp::exp(30 * 365 * dpp::log1p(.05_d64 / 365)) << std::endl;
+
+  // correctly rounded in every mode, at run time and in constant evaluation
+  constexpr auto c0(dpp::log(2_d64));
+  constexpr auto c1(dpp::log10(3_d32));
+  constexpr auto c2(dpp::log1p(.001_d16));
+
+  std::size_t d((c0 != dpp::log(2_d64)) + (c1 != dpp::log10(3_d32)) +
+    (c2 != dpp::log1p(.001_d16)));
+
+  d += check(modes_t<dpp::d16>(), d16_refs) +
+    check(modes_t<dpp::d32>(), d32_refs) +
+    check(modes_t<dpp::d64>(), d64_refs);
+
+  std::cout << "mismatches: " << d << std::endl;
+
+  //
+  return bool(d);
+}
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../exp.hpp"
+
+template <typename D>
+void run(int const lo, int const hi)
+{
+  std::vector<D> a;
+
+  {
+    std::mt19937_64 g;
+    std::uniform_real_distribution<double> x(lo, hi);
+
+    for (int i{}; 1000000 != i; ++i) a.emplace_back(x(g));
+  }
+
+  auto const bench(
+    [&](char const* const n, auto const f, auto const g)
+    {
+      std::vector<D> r0(a.size()), r1(a.size());
+
+      auto const t0(std::chrono::steady_clock::now());
+
+      for (std::size_t i{}; a.size() != i; ++i) r0[i] = f(a[i]);
+
+      auto const t1(std::chrono::steady_clock::now());
+
+      for (std::size_t i{}; a.size() != i; ++i) r1[i] = g(a[i]);
+
+      auto const t2(std::chrono::steady_clock::now());
+
+      std::size_t d{};
+
+      for (std::size_t i{}; a.size() != i; ++i) d += r0[i] != r1[i];
+
+      std::cout << n << " double: " <<
+        std::chrono::duration<double>(t1 - t0).count() << "s dpp: " <<
+        std::chrono::duration<double>(t2 - t1).count() << "s differing: " <<
+        d << std::endl;
+    }
+  );
+
+  bench(
+    "exp",
+    [](D const& x) noexcept { return D(std::exp(double(x))); },
+    [](D const& x) noexcept { return dpp::exp(x); }
+  );
+
+  bench(
+    "log",
+    [](D const& x) noexcept { return D(std::log(double(abs(x)))); },
+    [](D const& x) noexcept { return dpp::log(abs(x)); }
+  );
+
+  bench(
+    "log10",
+    [](D const& x) noexcept { return D(std::log10(double(abs(x)))); },
+    [](D const& x) noexcept { return dpp::log10(abs(x)); }
+  );
+}
+
+int main()
+{
+  run<dpp::d32>(-20, 20);
+  run<dpp::d64>(-40, 40);
+
+  return 0;
+}
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "../expr.hpp"
+
+using namespace dpp::literals;
+
+struct big
+{ // nonnegative, base 10^9 limbs, least significant first
+  using U = unsigned __int128;
+
+  std::vector<std::uint32_t> l;
+
+  explicit big(U a)
+  {
+    do l.push_back(a % 1000000000), a /= 1000000000; while (a);
+  }
+
+  void mul(std::uint64_t const b)
+  {
+    U c{};
+
+    for (auto& d: l) c += U(d) * b, d = c % 1000000000, c /= 1000000000;
+
+    for (; c; c /= 1000000000) l.push_back(c % 1000000000);
+  }
+
+  std::uint64_t div(std::uint64_t const b)
+  { // returns the remainder
+    U r{};
+
+    for (auto i(l.size()); i--;)
+    {
+      r = 1000000000 * r + l[i];
+      l[i] = r / b; r %= b;
+    }
+
+    for (; (l.size() > 1) && !l.back(); l.pop_back());
+
+    return r;
+  }
+
+  int digits() const noexcept
+  {
+    int n(9 * (l.size() - 1));
+
+    for (auto d(l.back()); d; d /= 10) ++n;
+
+    return n;
+  }
+
+  U value() const noexcept
+  {
+    U a{};
+
+    for (auto i(l.size()); i--;) a = 1000000000 * a + l[i];
+
+    return a;
+  }
+};
+
+template <typename D>
+D exact(D const& a, D const& b)
+{ // (a + b) * a / b, truncated to G digits, a sticky digit appended, G at
+  // least 2 digits more than those of D, rounded once by the constructor
+  using U = unsigned __int128;
+  using V = typename D::sig2_t;
+
+  constexpr int G(dpp::detail::maxpow10e<V>() - 1);
+
+  int e(std::min(a.exp(), b.exp()));
+
+  __int128 const s(__int128(a.sig()) *
+    dpp::detail::pow(__int128(10), a.exp() - e) + __int128(b.sig()) *
+    dpp::detail::pow(__int128(10), b.exp() - e));
+
+  if (!s || !a.sig()) return {};
+
+  auto const neg((s < 0) != (a.sig() < 0) != (b.sig() < 0));
+  std::uint64_t const m(a.sig() < 0 ? -a.sig() : a.sig()),
+    n(b.sig() < 0 ? -b.sig() : b.sig());
+
+  e += a.exp() - b.exp();
+
+  big q(s < 0 ? U(-s) : U(s));
+  q.mul(m);
+
+  for (int const k(G + big(n).digits()); q.digits() < k; --e) q.mul(10);
+
+  bool x(q.div(n));
+
+  for (; q.digits() > G; ++e) x = q.div(10) || x;
+
+  auto r(q.value());
+
+  if (x && !(r % 10)) ++r;
+
+  return D(neg ? -V(r) : V(r), e);
+}
+
+template <typename D>
+std::size_t exact() noexcept
+{ // (a + b) * a / b against the exact value; the second half has small
+  // divisors 2^i * 5^j, exact quotients and ties are common
+  using T = typename D::sig_t;
+
+  std::mt19937_64 g;
+  std::uniform_int_distribution<T> m(D::mmin, D::mmax), s(-999, 999);
+  std::uniform_int_distribution<int> e(-12, 0), f(0, 5);
+
+  std::size_t d{};
+
+  for (int i{}; 200000 != i; ++i)
+  {
+    D a, b;
+
+    if (i < 100000)
+      a = D(dpp::direct, m(g), e(g)), b = D(dpp::direct, m(g), e(g));
+    else
+    {
+      T t(1);
+
+      for (auto j(f(g)); j--;) t *= 2;
+      for (auto j(f(g)); j--;) t *= 5;
+
+      a = D(dpp::direct, s(g), e(g)), b = D(dpp::direct, i % 2 ? t : -t, e(g));
+    }
+
+    if (!b.sig()) continue;
+
+    using dpp::expr::lazy;
+
+    d += D((lazy(a) + b) * a / b) != exact(a, b);
+  }
+
+  return d;
+}
+
+template <typename D>
+using modes_t = std::tuple<
+  dpp::rounded_t<D, dpp::rounding::half_even>,
+  dpp::rounded_t<D, dpp::rounding::half_up>,
+  dpp::rounded_t<D, dpp::rounding::half_down>,
+  dpp::rounded_t<D, dpp::rounding::toward_zero>,
+  dpp::rounded_t<D, dpp::rounding::floor>,
+  dpp::rounded_t<D, dpp::rounding::ceil>
+>;
+
+template <typename ...D>
+std::size_t exact(std::tuple<D...>) noexcept { return (exact<D>() + ...); }
+
+int main()
+{
+  using dpp::expr::lazy;
+
+  auto const x(lazy(1.234567_d32));
+  auto const y(9.876543_d32);
+
+  std::cout << dpp::d32((x + y) * x / y) << ' ' << (1.234567_d32 + y) *
+    1.234567_d32 / y << std::endl;
+
+  std::cout << dpp::d32(x / 3 * 3) << ' ' << 1.234567_d32 / 3 * 3 <<
+    std::endl;
+
+  std::cout << dpp::expr::eval(fma(x, y, -x)) << ' ' <<
+    dpp::expr::eval(-x + 2_d32) << std::endl;
+
+  std::cout << dpp::expr::eval(x / 0) << std::endl;
+
+  constexpr dpp::d64 z((lazy(1_d64) + .5_d64) * 2_d64);
+  std::cout << z << std::endl;
+
+  // rounded once, x / 3 * 3 gives x back
+  std::size_t d((dpp::d32((x + y) * x / y) !=
+      exact(1.234567_d32, 9.876543_d32)) +
+    (dpp::d32(x / 3 * 3) != 1.234567_d32) +
+    (dpp::expr::eval(fma(x, y, -x)) != 10.95868706_d32) +
+    !isnan(dpp::expr::eval(x / 0)) + (z != 3_d64));
+
+  d += exact(modes_t<dpp::d16>()) + exact(modes_t<dpp::d32>()) +
+    exact(modes_t<dpp::d64>());
+
+  std::cout << "mismatches: " << d << std::endl;
+
+  return bool(d);
+}
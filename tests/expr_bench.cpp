@@ -0,0 +1,79 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../expr.hpp"
+
+template <typename D>
+void run()
+{
+  std::vector<D> a, b;
+
+  {
+    std::mt19937_64 g;
+    std::uniform_int_distribution<typename D::sig_t> m(1, D::mmax);
+    std::uniform_int_distribution<int> e(-12, 0);
+
+    for (int i{}; 1000000 != i; ++i)
+      a.emplace_back(dpp::direct, m(g), e(g)),
+      b.emplace_back(dpp::direct, m(g), e(g));
+  }
+
+  auto const bench(
+    [&](auto const f, auto const g)
+    {
+      std::vector<D> r0(a.size()), r1(a.size());
+
+      auto const t0(std::chrono::steady_clock::now());
+
+      for (std::size_t i{}; a.size() != i; ++i) r0[i] = f(a[i], b[i]);
+
+      auto const t1(std::chrono::steady_clock::now());
+
+      for (std::size_t i{}; a.size() != i; ++i) r1[i] = g(a[i], b[i]);
+
+      auto const t2(std::chrono::steady_clock::now());
+
+      std::size_t d{};
+
+      for (std::size_t i{}; a.size() != i; ++i) d += r0[i] != r1[i];
+
+      std::cout << "eager: " <<
+        std::chrono::duration<double>(t1 - t0).count() << "s lazy: " <<
+        std::chrono::duration<double>(t2 - t1).count() << "s differing: " <<
+        d << std::endl;
+    }
+  );
+
+  using dpp::expr::lazy;
+
+  bench(
+    [](D const& a, D const& b) noexcept { return (a + b) * a / b; },
+    [](D const& a, D const& b) noexcept -> D
+    {
+      return (lazy(a) + b) * a / b;
+    }
+  );
+
+  bench(
+    [](D const& a, D const& b) noexcept
+    {
+      return a * b + a * a - b * b + 3 * a - b;
+    },
+    [](D const& a, D const& b) noexcept -> D
+    {
+      auto const x(lazy(a));
+
+      return x * b + x * a - lazy(b) * b + 3 * x - b;
+    }
+  );
+}
+
+int main()
+{
+  run<dpp::d32>();
+  run<dpp::d64>();
+
+  return 0;
+}
@@ -0,0 +1,152 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../linalg.hpp"
+#include "../trig.hpp"
+
+using namespace dpp::literals;
+
+template <typename D>
+auto rotation(D const ax, D const ay) noexcept
+{ // as in cube.cpp
+  auto const [sx, cx](dpp::sincos(ax));
+  auto const [sy, cy](dpp::sincos(ay));
+
+  return dpp::mat<D, 3, 3>{
+    dpp::vec<D, 3>{cy, sx * sy, cx * sy},
+    dpp::vec<D, 3>{D{}, cx, -sx},
+    dpp::vec<D, 3>{-sy, sx * cy, cx * cy}
+  };
+}
+
+template <dpp::rounding R>
+auto exact() noexcept
+{ // dot() against the exact sum in __int128, rounded by the constructor
+  using D = dpp::rounded_t<dpp::d32, R>;
+
+  std::mt19937_64 g;
+  std::uniform_int_distribution<std::int32_t> m(D::mmin, D::mmax), k(0, 9);
+  std::uniform_int_distribution<int> e(-4, 4), l(1, 8);
+
+  std::size_t d{};
+
+  for (int i{}; 100000 != i; ++i)
+  {
+    D a[8], b[8];
+
+    auto const n(l(g));
+
+    for (int j{}; n != j; ++j)
+    { // short significands, or the negated previous product, cancel
+      a[j] = D(dpp::direct, k(g) ? m(g) : k(g), e(g));
+      b[j] = D(dpp::direct, k(g) ? m(g) : k(g), e(g));
+
+      if (j && !k(g)) a[j] = -a[j - 1], b[j] = b[j - 1];
+    }
+
+    __int128 s{};
+
+    for (int j{}; n != j; ++j)
+      s += __int128(a[j].sig()) * b[j].sig() *
+        dpp::detail::pow(__int128(10), a[j].exp() + b[j].exp() + 8);
+
+    d += dpp::dot(a, b, n) != D(s, -8);
+  }
+
+  return d;
+}
+
+template <typename D>
+void run(char const* const n)
+{
+  constexpr std::size_t N(1000000);
+
+  std::vector<D> x(N), y(N), z(N);
+
+  {
+    std::mt19937_64 g;
+    std::uniform_real_distribution<double> d(-100, 100);
+
+    for (std::size_t i{}; N != i; ++i) x[i] = d(g), y[i] = d(g), z[i] = d(g);
+  }
+
+  auto const a(rotation(D(.3), D(-.7)));
+
+  std::vector<D> u(N), v(N), w(N);
+
+  auto const t0(std::chrono::steady_clock::now());
+
+  for (std::size_t i{}; N != i; ++i)
+  { // a product and a rounding per term, as in cube.cpp
+    u[i] = a[0][0] * x[i] + a[0][1] * y[i] + a[0][2] * z[i];
+    v[i] = a[1][0] * x[i] + a[1][1] * y[i] + a[1][2] * z[i];
+    w[i] = a[2][0] * x[i] + a[2][1] * y[i] + a[2][2] * z[i];
+  }
+
+  auto const t1(std::chrono::steady_clock::now());
+
+  dpp::transform(a, {x.data(), y.data(), z.data()},
+    {x.data(), y.data(), z.data()}, N);
+
+  auto const t2(std::chrono::steady_clock::now());
+
+  std::size_t d{};
+
+  for (std::size_t i{}; N != i; ++i)
+    d += (u[i] != x[i]) || (v[i] != y[i]) || (w[i] != z[i]);
+
+  std::cout << n << " naive: " <<
+    std::chrono::duration<double>(t1 - t0).count() << "s transform: " <<
+    std::chrono::duration<double>(t2 - t1).count() << "s differing: " <<
+    d << ' ' << u[0] << ' ' << x[0] << std::endl;
+}
+
+int main()
+{
+  using V = dpp::vec<dpp::d64, 3>;
+
+  V const a{1_d64, 2_d64, 3_d64}, b{-4_d64, .5_d64, 2_d64};
+
+  std::cout << a + b << ' ' << a - b << ' ' << a * 2_d64 << ' ' <<
+    dot(a, b) << ' ' << cross(a, b) << ' ' << length(a) << ' ' <<
+    normalize(b) << ' ' << length(normalize(b)) << std::endl;
+
+  // rounded once: 1 + 10^-10 - 1 = 10^-10, not 0
+  using W = dpp::vec<dpp::d32, 3>;
+
+  W const c{1_d32, dpp::d32(dpp::direct, 1, -10), 1_d32},
+    e{1_d32, 1_d32, -1_d32};
+
+  std::cout << dot(c, e) << ' ' <<
+    c[0] * e[0] + c[1] * e[1] + c[2] * e[2] << ' ' <<
+    dot(W{dpp::nan, 1_d32, 1_d32}, e) << std::endl;
+
+  // the sticky digits of opposite-signed terms must not cancel
+  {
+    using F = dpp::rounded_t<dpp::d32, dpp::rounding::floor>;
+
+    F const u[]{F(dpp::direct, -1933, 5), F(dpp::direct, 21, -8),
+      F(dpp::direct, -20, -8)},
+      v[]{F(dpp::direct, 180732, 4), F(dpp::direct, 52197, -7), F(1)};
+
+    std::cout << dpp::dot(u, v, 3) << ' ' <<
+      exact<dpp::rounding::half_up>() << ' ' <<
+      exact<dpp::rounding::half_even>() << ' ' <<
+      exact<dpp::rounding::half_down>() << ' ' <<
+      exact<dpp::rounding::toward_zero>() << ' ' <<
+      exact<dpp::rounding::floor>() << ' ' <<
+      exact<dpp::rounding::ceil>() << std::endl;
+  }
+
+  dpp::mat<dpp::d64, 2, 3> const m{V{1_d64, 0_d64, 2_d64},
+    V{0_d64, 1_d64, -1_d64}};
+
+  std::cout << m * a << ' ' << (transpose(m) * m)[2] << std::endl;
+
+  run<dpp::d32>("d32");
+  run<dpp::d64>("d64");
+
+  return 0;
+}
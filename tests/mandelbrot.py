@@ -1,3 +1,4 @@
+import copy
 import dpp
 import shutil
 
@@ -38,7 +39,7 @@ def main():
     y += dy / 2
 
     for i in range(h):
-        x = x0
+        x = copy.copy(x0)  # += mutates x
         for j in range(w):
             t = mandelbrot(x, y) / max_iter
             olt = 1 - t
@@ -0,0 +1,382 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "../pow.hpp"
+
+using namespace dpp::literals;
+
+struct big
+{ // nonnegative, base 10^9 limbs, least significant first
+  using U = unsigned __int128;
+
+  std::vector<std::uint32_t> l;
+
+  explicit big(U a)
+  {
+    do l.push_back(a % 1000000000), a /= 1000000000; while (a);
+  }
+
+  void mul(std::uint64_t const b)
+  {
+    U c{};
+
+    for (auto& d: l) c += U(d) * b, d = c % 1000000000, c /= 1000000000;
+
+    for (; c; c /= 1000000000) l.push_back(c % 1000000000);
+  }
+
+  std::uint64_t div(std::uint64_t const b)
+  { // returns the remainder
+    U r{};
+
+    for (auto i(l.size()); i--;)
+    {
+      r = 1000000000 * r + l[i];
+      l[i] = r / b; r %= b;
+    }
+
+    for (; (l.size() > 1) && !l.back(); l.pop_back());
+
+    return r;
+  }
+
+  int digits() const noexcept
+  {
+    int n(9 * (l.size() - 1));
+
+    for (auto d(l.back()); d; d /= 10) ++n;
+
+    return n;
+  }
+
+  U value() const noexcept
+  {
+    U a{};
+
+    for (auto i(l.size()); i--;) a = 1000000000 * a + l[i];
+
+    return a;
+  }
+};
+
+template <typename>
+struct mode;
+
+template <typename T, typename E, dpp::rounding R>
+struct mode<dpp::dpp<T, E, R>>
+{
+  static constexpr auto value{R};
+};
+
+template <typename D>
+D nearest(bool const neg, big n, std::uint64_t const d, int e)
+{ // n / d * 10^e, rounded in the mode of D to the nearest representable
+  // values below and above it, lo and hi; past mmax, the next one is C, the
+  // multiple of 10 above mmax, a digit further up
+  using U = unsigned __int128;
+  using dpp::rounding;
+
+  constexpr auto R(mode<D>::value);
+  constexpr U M(D::mmax), C(10 * ((M + 10) / 10));
+  constexpr int P([]() noexcept { int n{}; for (auto m(M); m; m /= 10) ++n;
+    return n; }());
+
+  int k{};
+  for (auto t(d); t; t /= 10) ++k;
+
+  for (; n.digits() < k + P + 3; --e) n.mul(10);
+
+  bool x(n.div(d));
+
+  // B / 100 in (mmax, 10 mmax + 9], units of 10^e
+  for (; (n.digits() > P + 3) || (n.value() / 100 > 10 * M + 9); ++e)
+    x = n.div(10) || x;
+
+  U const B(n.value());
+  U const lo(std::max(100 * M, B / 1000 * 1000)),
+    c(B / 1000 + (B % 1000 || x)), hi(c <= M ? 1000 * c : 1000 * C);
+
+  bool up;
+
+  if ((B == lo) && !x) up = false;
+  else if constexpr(rounding::toward_zero == R) up = false;
+  else if constexpr(rounding::floor == R) up = neg;
+  else if constexpr(rounding::ceil == R) up = !neg;
+  else if (2 * B != lo + hi) up = 2 * B > lo + hi;
+  else if (x || (rounding::half_up == R)) up = true;
+  else if constexpr(rounding::half_down == R) up = false;
+  else // half_even, toward mmax in the gap past it
+    up = (100 * M != lo) && (lo / 1000 % 2);
+
+  auto const r(up ? hi : lo);
+  auto const s([&](U const m, int const f) noexcept
+    {
+      return D(dpp::direct, typename D::sig_t(neg ? -m : m), f);
+    }
+  );
+
+  return 100 * M == r ? s(M, e + 2) : r / 1000 <= M ? s(r / 1000, e + 3) :
+    s(C / 10, e + 4);
+}
+
+template <typename D>
+D exact_pow(D const& x, int const n)
+{ // x^n, |x.sig()|^-n fits std::uint64_t if n < 0
+  using U = unsigned __int128;
+
+  U const a(x.sig() < 0 ? -__int128(x.sig()) : x.sig());
+  bool const neg((x.sig() < 0) && (n % 2));
+
+  if (n > 0)
+  {
+    big p(1);
+
+    for (auto i(n); i--;) p.mul(std::uint64_t(a));
+
+    return nearest<D>(neg, p, 1, n * x.exp());
+  }
+  else
+  {
+    U d(1);
+
+    for (auto i(-n); i--;) d *= a;
+
+    return nearest<D>(neg, big(1), std::uint64_t(d), n * x.exp());
+  }
+}
+
+template <typename D>
+std::size_t exact(int const nmin, int const nmax) noexcept
+{ // x^n against the exact value, correctly rounded up to n = 7, within an
+  // ulp, between the floor and the ceiling, beyond
+  using T = typename D::sig_t;
+  using F = dpp::rounded_t<D, dpp::rounding::floor>;
+  using C = dpp::rounded_t<D, dpp::rounding::ceil>;
+
+  auto const eq([](D const& a, auto const& b) noexcept
+    {
+      return (a.sig() == b.sig()) && (a.exp() == b.exp()) ||
+        (a == D(dpp::direct, b.sig(), b.exp()));
+    }
+  );
+
+  std::mt19937_64 g;
+  std::uniform_int_distribution<T> m(D::mmin, D::mmax), s(-999, 999);
+  std::uniform_int_distribution<int> e(-2, 2), k(nmin, nmax);
+
+  std::size_t d{};
+
+  for (int i{}; 20000 != i; ++i)
+  {
+    D const x(dpp::direct, i % 2 ? m(g) : s(g), e(g));
+
+    if (int const n(k(g)); !x.sig() || !n) continue;
+    else if (auto const r(dpp::pow(x, n)); n <= 7)
+      d += !eq(r, exact_pow(x, n));
+    else
+    {
+      auto const lo(exact_pow(F(dpp::direct, x.sig(), x.exp()), n)),
+        hi(exact_pow(C(dpp::direct, x.sig(), x.exp()), n));
+
+      d += !eq(r, lo) && !eq(r, hi);
+    }
+  }
+
+  return d;
+}
+
+struct ref_t
+{ // x^y, x = m * 10^e, y = n * 10^f, 40 digits, truncated, "..." if inexact
+  std::int64_t m;
+  int e;
+  std::int64_t n;
+  int f;
+  char const* r;
+};
+
+// generated with Python's decimal module, 60 digits of precision, from
+//   Decimal(m).scaleb(e) ** Decimal(n).scaleb(f)
+// exact if a short decimal c, c^q = x^p, y = p / q in lowest terms
+
+constexpr ref_t refs[]{
+  {2, 0, 5, -1, "1.414213562373095048801688724209698078569...e+0"},
+  {5, -1, 25, -2, "8.408964152537145430311254762332148950400...e-1"},
+  {10, 0, 5, -1, "3.162277660168379331998893544432718533719...e+0"},
+  {2, 0, 15, -1, "2.828427124746190097603377448419396157139...e+0"},
+  {3, 0, -5, -1, "5.773502691896257645091487805019574556476...e-1"},
+  {15, -1, 25, -1, "2.755675960631075360471944584044127815961...e+0"},
+  {4, 0, 5, -1, "2e+0"},
+  {121, -2, 5, -1, "1.1e+0"},
+  {16, 0, 25, -2, "2e+0"},
+  {100, 0, -5, -1, "1e-1"},
+  {625, -4, -75, -2, "8e+0"},
+  {27, 0, -25, -1, "2.639918926335737377728160861920244424543...e-4"},
+  {2, 0, 1005, -1, "1.792728671193156477399422023278661496394...e+30"},
+  {5, -1, 1, -3, "9.993070929904525219223793553635018186710...e-1"},
+  {15, -1, -1234, -1, "1.863539628465081305111788189244279773664...e-22"},
+  {9999, -4, 5, -1, "9.999499987499374960934765419905760409436...e-1"},
+  {10001, -4, -3, 0, "9.997000599900014997900279964004499450065...e-1"},
+  {7, 0, 12345, -4, "1.104774217474747048468846123414709942666...e+1"},
+  {1, -5, 5, -1, "3.162277660168379331998893544432718533719...e-3"},
+  {32767, 0, -31, -1, "1.004954243697073214981623660615155825643...e-14"},
+};
+
+constexpr ref_t d32_refs[]{
+  {144272510, 0, -7933, -4, "3.367593479864409040135266325131673853002...e-7"},
+  {126614243, -2, 4728, -3, "7.120943776602285658415134012479259408950...e+28"},
+  {699642631, -3, -3121, -6, "9.588664895555343138985825977067008468694...e-1"},
+  {523832097, -9, 2773, -3, "1.664637633985984566278120722128025332565...e-1"},
+  {652231582, -9, 4594, -4, "8.217433496142368870238392121019522067160...e-1"},
+  {967900367, -4, -8998, -6, "9.018566163500998388693069259822024003053...e-1"},
+  {737106431, -6, 3831, -6, "1.025617702244444732167296220051679862870...e+0"},
+  {566537776, -6, 4348, -3, "9.354899825791767577651236761664071675187...e+11"},
+  {593628451, -6, 1327, -5, "1.088440116566647364200228719894026802576...e+0"},
+  {994828919, -9, 3637, -6, "9.999811441610550618930022722759364810545...e-1"},
+  {199615330, -5, -6039, -4, "1.016278900819310854389035955463219904931...e-2"},
+  {961616758, -1, 3831, -5, "2.022221891437896654452695438028287297073...e+0"},
+};
+
+constexpr ref_t d64_refs[]{
+  {1414213562373095049, -18, 2, 0, "2.000000000000000000560908991588312401e+0"},
+  {453505852357887942, 0, 832421924, -11,
+    "1.402740276843613195032661248129298023179...e+0"},
+  {279860131199461309, -6, -110267462, -10,
+    "7.477862692901431321167116010384345659507...e-1"},
+  {586175838033807367, -15, 671692785, -10,
+    "1.534357066383051001289070414195261717851...e+0"},
+  {968398197000779845, -6, -204308628, -8,
+    "3.246815257080403461271062248410909666839...e-25"},
+  {34097611071195716, -3, -906611754, -9,
+    "5.383607640369497294649775510007757080524...e-13"},
+  {978025122165217597, 0, 241623302, -8,
+    "2.943592832057747098728681187000712986933...e+43"},
+  {196399253678720729, -13, 78549098, -10,
+    "1.080742489532656791369276650695236372348...e+0"},
+  {14182759323492348, -12, 158819637, -10,
+    "1.163960153855439066861625008015320942665...e+0"},
+  {760022931226984428, -1, 307699045, -11,
+    "1.127047298966102906113171208569074968178...e+0"},
+  {903492968461728712, -2, 737614708, -10,
+    "1.502908288303161944781975522133197189920...e+1"},
+  {64705760862457176, -3, 868332582, -9,
+    "9.828602025439039660597107677950933773058...e+11"},
+  {639181059823204859, -12, 83878953, -8,
+    "7.407924378686903816745057377833776314233...e+4"},
+};
+
+template <typename D>
+D expected(std::string_view s) noexcept
+{ // s rounded once by the constructor: the digits that fit sig2_t, and a
+  // sticky digit, if any digit beyond them is nonzero, or if s is inexact
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  constexpr int L(dpp::detail::maxpow10e<U>());
+
+  bool const neg('-' == s.front());
+
+  if (neg) s.remove_prefix(1);
+
+  auto const p(s.find('e'));
+
+  U m{};
+  F e(std::atoi(s.data() + p + 1) + 1);
+  bool x(s.substr(0, p).ends_with("..."));
+
+  for (int n{}; auto const c: s.substr(0, p))
+  {
+    if (('0' > c) || ('9' < c)) continue;
+    else if (L > n++) m = U(10) * m + U(c - '0'), --e;
+    else x = x || ('0' != c);
+  }
+
+  if (x && !(m % U(10))) ++m;
+
+  return D(neg ? -m : m, e);
+}
+
+template <typename D, std::size_t N>
+std::size_t check(ref_t const (&refs)[N]) noexcept
+{ // x^y against the references, correctly rounded
+  using T = typename D::sig_t;
+
+  std::size_t d{};
+
+  for (auto const& [m, e, n, f, r]: refs)
+  {
+    D const x(dpp::direct, T(m), e), y(dpp::direct, T(n), f);
+
+    if (auto const z(pow(x, y)), w(expected<D>(r)); isnan(z) || (z != w))
+    {
+      ++d;
+
+      std::cout << "pow(" << x << ", " << y << ") = " << z <<
+        ", expected " << w << std::endl;
+    }
+  }
+
+  return d;
+}
+
+template <typename D>
+using modes_t = std::tuple<
+  dpp::rounded_t<D, dpp::rounding::half_even>,
+  dpp::rounded_t<D, dpp::rounding::half_up>,
+  dpp::rounded_t<D, dpp::rounding::half_down>,
+  dpp::rounded_t<D, dpp::rounding::toward_zero>,
+  dpp::rounded_t<D, dpp::rounding::floor>,
+  dpp::rounded_t<D, dpp::rounding::ceil>
+>;
+
+template <typename ...D>
+std::size_t exact(std::tuple<D...>, int const nmin, int const nmax) noexcept
+{
+  return (exact<D>(nmin, nmax) + ...);
+}
+
+template <typename ...D, std::size_t N>
+std::size_t check(std::tuple<D...>, ref_t const (&refs)[N]) noexcept
+{
+  return (check<D>(refs) + ...);
+}
+
+int main()
+{
+  using dpp::direct;
+
+  std::size_t d(
+    (dpp::pow(1.05_d32, 30) != dpp::d32(direct, 432194238, -8)) +
+    (dpp::pow(1.05_d64, 30) != dpp::d64(direct, 4321942375150662009, -18)) +
+    (dpp::pow(1.0001_d64, 10000) !=
+      dpp::d64(direct, 2718145926825224864, -18)) +
+    (dpp::pow(2_d64, 62) != dpp::d64(direct, 4611686018427387904, 0)) +
+    (dpp::pow(2_d64, -10) != dpp::d64(direct, 9765625, -10)) +
+    (dpp::pow(-.1_d64, 3) != dpp::d64(direct, -1, -3)) +
+    (dpp::pow(100_d64, -5) != dpp::d64(direct, 1, -10)) +
+    (dpp::pow(-2_d64, 3_d64) != dpp::d64(direct, -8, 0)) +
+    !isnan(dpp::pow(10_d64, 40000)) + !isnan(dpp::pow(3_d64, 1000000)) +
+    (dpp::pow(.3_d64, 1000000) != 0_d64) + !isnan(dpp::pow(-2_d64, .5_d64)) +
+    !isnan(dpp::pow(0_d64, -1))
+  );
+
+  // integral exponents, |x^-n| fits std::uint64_t
+  d += exact(modes_t<dpp::d16>(), -3, 7) + exact(modes_t<dpp::d32>(), -2, 40) +
+    exact(modes_t<dpp::d64>(), -1, 40);
+
+  d += check(modes_t<dpp::d16>(), refs) + check(modes_t<dpp::d32>(), refs) +
+    check(modes_t<dpp::d32>(), d32_refs) + check(modes_t<dpp::d64>(), refs) +
+    check(modes_t<dpp::d64>(), d64_refs);
+
+  std::cout << dpp::pow(2_d64, .5_d64) << ' ' << dpp::pow(2_d128, .5_d128) <<
+    ' ' << dpp::pow(.5_d64, 1 / 2.2) << std::endl;
+
+  std::cout << "mismatches: " << d << std::endl;
+
+  return bool(d);
+}
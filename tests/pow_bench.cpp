@@ -0,0 +1,55 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../pow.hpp"
+
+template <typename D>
+void run()
+{
+  std::vector<D> a;
+  std::vector<int> n;
+
+  {
+    std::mt19937_64 g;
+    std::uniform_int_distribution<int> r(1, 2000), m(1, 360);
+
+    for (int i{}; 100000 != i; ++i)
+      a.emplace_back(D(1) + D(dpp::direct, r(g), -5)), n.push_back(m(g));
+  }
+
+  std::vector<D> r0(a.size()), r1(a.size());
+
+  auto const t0(std::chrono::steady_clock::now());
+
+  for (std::size_t i{}; a.size() != i; ++i)
+  { // (1 + r)^n
+    D r(1);
+    for (auto j(n[i]); j; --j) r *= a[i];
+    r0[i] = r;
+  }
+
+  auto const t1(std::chrono::steady_clock::now());
+
+  for (std::size_t i{}; a.size() != i; ++i) r1[i] = dpp::pow(a[i], n[i]);
+
+  auto const t2(std::chrono::steady_clock::now());
+
+  std::size_t d{};
+
+  for (std::size_t i{}; a.size() != i; ++i) d += r0[i] != r1[i];
+
+  std::cout << "loop: " <<
+    std::chrono::duration<double>(t1 - t0).count() << "s pow: " <<
+    std::chrono::duration<double>(t2 - t1).count() << "s differing: " <<
+    d << std::endl;
+}
+
+int main()
+{
+  run<dpp::d32>();
+  run<dpp::d64>();
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../radix_sort.hpp"
+
+using namespace dpp::literals;
+
+int main()
+{
+  using D = dpp::d64;
+
+  std::vector<D> v;
+
+  {
+    std::mt19937_64 g;
+    std::uniform_int_distribution<std::int64_t> m(-1000000, 1000000);
+    std::uniform_int_distribution<int> e(-8, 2);
+
+    for (auto i(1000000); i; --i) v.emplace_back(m(g), e(g));
+  }
+
+  auto w(v);
+
+  auto const t0(std::chrono::steady_clock::now());
+  dpp::radix_sort(v.begin(), v.end());
+  auto const t1(std::chrono::steady_clock::now());
+  std::stable_sort(w.begin(), w.end(),
+    [](auto const& a, auto const& b) noexcept { return a < b; });
+  auto const t2(std::chrono::steady_clock::now());
+
+  std::cout << "radix_sort: " <<
+    std::chrono::duration<double>(t1 - t0).count() << "s" << std::endl;
+  std::cout << "std::stable_sort: " <<
+    std::chrono::duration<double>(t2 - t1).count() << "s" << std::endl;
+
+  auto const same(std::equal(v.begin(), v.end(), w.begin(),
+    [](auto const& a, auto const& b) noexcept
+    { // stable: equal values keep their representation order
+      return (a.sig() == b.sig()) && (a.exp() == b.exp());
+    }
+  ));
+
+  //
+  std::vector<D> k{3_d64, 1.0_d64, 2_d64, 1_d64, D(dpp::nan), -5_d64};
+  std::vector<char> c{'a', 'b', 'c', 'd', 'e', 'f'};
+
+  dpp::radix_sort_by_key(k.begin(), k.end(), c.begin());
+
+  for (std::size_t i{}; k.size() != i; ++i)
+    std::cout << k[i] << " " << c[i] << std::endl;
+
+  std::cout << (same ? "ok" : "fail") << std::endl;
+
+  return !same;
+}
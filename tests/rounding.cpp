@@ -0,0 +1,344 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "../utils.hpp"
+
+using namespace dpp::literals;
+
+struct big
+{ // nonnegative, base 10^9 limbs, least significant first
+  using U = unsigned __int128;
+
+  std::vector<std::uint32_t> l;
+
+  explicit big(U a)
+  {
+    do l.push_back(a % 1000000000), a /= 1000000000; while (a);
+  }
+
+  void mul(std::uint64_t const b)
+  {
+    U c{};
+
+    for (auto& d: l) c += U(d) * b, d = c % 1000000000, c /= 1000000000;
+
+    for (; c; c /= 1000000000) l.push_back(c % 1000000000);
+
+    trim();
+  }
+
+  std::uint64_t div(std::uint64_t const b)
+  { // returns the remainder
+    U r{};
+
+    for (auto i(l.size()); i--;)
+    {
+      r = 1000000000 * r + l[i];
+      l[i] = r / b; r %= b;
+    }
+
+    trim();
+
+    return r;
+  }
+
+  void add(big const& b)
+  {
+    l.resize(std::max(l.size(), b.l.size()) + 1);
+
+    std::uint32_t c{};
+
+    for (std::size_t i{}; l.size() != i; ++i)
+    {
+      auto const t(l[i] + c + (i < b.l.size() ? b.l[i] : 0));
+
+      l[i] = t % 1000000000; c = t / 1000000000;
+    }
+
+    trim();
+  }
+
+  void sub(big const& b)
+  { // *this >= b
+    std::int64_t c{};
+
+    for (std::size_t i{}; l.size() != i; ++i)
+    {
+      auto t(std::int64_t(l[i]) - c - (i < b.l.size() ? b.l[i] : 0));
+
+      c = t < 0;
+      l[i] = t + c * 1000000000;
+    }
+
+    trim();
+  }
+
+  void trim()
+  {
+    for (; (l.size() > 1) && !l.back(); l.pop_back());
+  }
+
+  bool less(big const& b) const noexcept
+  {
+    return l.size() != b.l.size() ? l.size() < b.l.size() :
+      std::lexicographical_compare(l.rbegin(), l.rend(), b.l.rbegin(),
+        b.l.rend());
+  }
+
+  int digits() const noexcept
+  {
+    int n(9 * (l.size() - 1));
+
+    for (auto d(l.back()); d; d /= 10) ++n;
+
+    return n;
+  }
+
+  U value() const noexcept
+  {
+    U a{};
+
+    for (auto i(l.size()); i--;) a = 1000000000 * a + l[i];
+
+    return a;
+  }
+};
+
+template <typename>
+struct mode;
+
+template <typename T, typename E, dpp::rounding R>
+struct mode<dpp::dpp<T, E, R>>
+{
+  static constexpr auto value{R};
+};
+
+template <typename D>
+D nearest(bool const neg, big n, std::uint64_t const d, int e)
+{ // n / d * 10^e, rounded in the mode of D to the nearest representable
+  // values below and above it, lo and hi; past mmax, the next one is C, the
+  // multiple of 10 above mmax, a digit further up
+  using U = unsigned __int128;
+  using dpp::rounding;
+
+  constexpr auto R(mode<D>::value);
+  constexpr U M(D::mmax), C(10 * ((M + 10) / 10));
+  constexpr int P([]() noexcept { int n{}; for (auto m(M); m; m /= 10) ++n;
+    return n; }());
+
+  if (!n.value() && (1 == n.l.size())) return {};
+
+  int k{};
+  for (auto t(d); t; t /= 10) ++k;
+
+  for (; n.digits() < k + P + 3; --e) n.mul(10);
+
+  bool x(n.div(d));
+
+  // B / 100 in (mmax, 10 mmax + 9], units of 10^e
+  for (; (n.digits() > P + 3) || (n.value() / 100 > 10 * M + 9); ++e)
+    x = n.div(10) || x;
+
+  U const B(n.value());
+  U const lo(std::max(100 * M, B / 1000 * 1000)),
+    c(B / 1000 + (B % 1000 || x)), hi(c <= M ? 1000 * c : 1000 * C);
+
+  bool up;
+
+  if ((B == lo) && !x) up = false;
+  else if constexpr(rounding::toward_zero == R) up = false;
+  else if constexpr(rounding::floor == R) up = neg;
+  else if constexpr(rounding::ceil == R) up = !neg;
+  else if (2 * B != lo + hi) up = 2 * B > lo + hi;
+  else if (x || (rounding::half_up == R)) up = true;
+  else if constexpr(rounding::half_down == R) up = false;
+  else // half_even, toward mmax in the gap past it
+    up = (100 * M != lo) && (lo / 1000 % 2);
+
+  auto const r(up ? hi : lo);
+  auto const s([&](U const m, int const f) noexcept
+    {
+      return D(dpp::direct, typename D::sig_t(neg ? -m : m), f);
+    }
+  );
+
+  return 100 * M == r ? s(M, e + 2) : r / 1000 <= M ? s(r / 1000, e + 3) :
+    s(C / 10, e + 4);
+}
+
+template <typename D>
+D exact_add(D const& a, D const& b)
+{ // a + b
+  using U = unsigned __int128;
+
+  int const e(std::min(a.exp(), b.exp()));
+
+  auto const mag([&](D const& v) noexcept
+    {
+      big n(U(v.sig() < 0 ? -__int128(v.sig()) : v.sig()));
+
+      for (auto i(v.exp() - e); i--;) n.mul(10);
+
+      return n;
+    }
+  );
+
+  auto p(mag(a)), q(mag(b));
+  bool const na(a.sig() < 0), nb(b.sig() < 0);
+
+  if (na == nb) return p.add(q), nearest<D>(na, p, 1, e);
+  else if (p.less(q)) return q.sub(p), nearest<D>(nb, q, 1, e);
+  else return p.sub(q), nearest<D>(na, p, 1, e);
+}
+
+template <typename D>
+D exact_fma(D const& a, D const& b, D const& c)
+{ // a * b + c, the product as one significand
+  using U = unsigned __int128;
+
+  auto const m(__int128(a.sig()) * b.sig());
+  int const ep(a.exp() + b.exp()), e(std::min(ep, int(c.exp())));
+
+  big p(U(m < 0 ? -m : m)), q(U(c.sig() < 0 ? -__int128(c.sig()) :
+    c.sig()));
+
+  for (auto i(ep - e); i--;) p.mul(10);
+  for (auto i(c.exp() - e); i--;) q.mul(10);
+
+  bool const na(m < 0), nb(c.sig() < 0);
+
+  if (!m) return c;
+  else if (na == nb) return p.add(q), nearest<D>(na, p, 1, e);
+  else if (p.less(q)) return q.sub(p), nearest<D>(nb, q, 1, e);
+  else return p.sub(q), nearest<D>(na, p, 1, e);
+}
+
+template <typename D>
+D exact_mul(D const& a, D const& b)
+{
+  using U = unsigned __int128;
+
+  auto const m(__int128(a.sig()) * b.sig());
+
+  return nearest<D>(m < 0, big(U(m < 0 ? -m : m)), 1, a.exp() + b.exp());
+}
+
+template <typename D>
+D exact_div(D const& a, D const& b)
+{
+  using U = unsigned __int128;
+
+  auto const m(a.sig() < 0 ? -__int128(a.sig()) : a.sig()),
+    n(b.sig() < 0 ? -__int128(b.sig()) : b.sig());
+
+  return nearest<D>((a.sig() < 0) != (b.sig() < 0), big(U(m)), n,
+    a.exp() - b.exp());
+}
+
+template <typename D>
+std::size_t exact() noexcept
+{ // +, -, *, /, fma and div<B> against the exact values; the second half
+  // has few digits, exact results and ties are common
+  using T = typename D::sig_t;
+
+  auto const eq([](D const& a, D const& b) noexcept
+    {
+      return (a.sig() == b.sig()) && (a.exp() == b.exp()) ||
+        (!a.sig() && !b.sig()) || (a == b);
+    }
+  );
+
+  std::mt19937_64 g;
+  std::uniform_int_distribution<T> m(D::mmin, D::mmax), s(-999, 999),
+    t(D::mmax - 20, D::mmax);
+  std::uniform_int_distribution<int> e(-6, 0), f(0, 2);
+
+  std::size_t d{};
+
+  for (int i{}; 100000 != i; ++i)
+  {
+    auto const r([&]() noexcept -> D
+      {
+        switch (i % 3 ? f(g) : 0)
+        {
+          case 0: return D(dpp::direct, m(g), e(g));
+          case 1: return D(dpp::direct, s(g), e(g));
+          default: return D(dpp::direct, i % 2 ? t(g) : T(-t(g)), e(g));
+        }
+      }
+    );
+
+    D const a(r()), b(r()), c(r());
+
+    d += !eq(a + b, exact_add(a, b)) + !eq(a - b, exact_add(a, -b)) +
+      !eq(a * b, exact_mul(a, b)) + !eq(fma(a, b, c), exact_fma(a, b, c)) +
+      !eq(dpp::div<7>(a), exact_div(a, D(7))) +
+      !eq(dpp::div<-12>(a), exact_div(a, D(-12)));
+
+    if (b.sig()) d += !eq(a / b, exact_div(a, b));
+  }
+
+  return d;
+}
+
+template <typename D>
+using modes_t = std::tuple<
+  dpp::rounded_t<D, dpp::rounding::half_even>,
+  dpp::rounded_t<D, dpp::rounding::half_up>,
+  dpp::rounded_t<D, dpp::rounding::half_down>,
+  dpp::rounded_t<D, dpp::rounding::toward_zero>,
+  dpp::rounded_t<D, dpp::rounding::floor>,
+  dpp::rounded_t<D, dpp::rounding::ceil>
+>;
+
+template <typename ...D>
+std::size_t exact(std::tuple<D...>) noexcept { return (exact<D>() + ...); }
+
+int main()
+{
+  using dpp::rounding;
+
+  // banker's rounding
+  using E = dpp::rounded_t<dpp::d32, rounding::half_even>;
+
+  std::size_t d((E(2.5) * E(1) != E(dpp::direct, 25, -1)) +
+    (dpp::quantize(E(dpp::direct, 25, -1), 0) != E(2)) +
+    (dpp::quantize(E(dpp::direct, 35, -1), 0) != E(4)));
+
+  // the quotient has a guard digit in every mode
+  d += dpp::d32(dpp::direct, -2033112, -1) /
+    dpp::d32(dpp::direct, 1050829471, -4) !=
+    dpp::d32(dpp::direct, -1934768729, -9);
+
+  // just past the largest significand, up to the multiple of 10 above it,
+  // or down to mmax
+  {
+    using U = dpp::d16::sig2_t;
+
+    d += (dpp::d16(U(327669), -20) != dpp::d16(dpp::direct, 32767, -19)) +
+      (dpp::d16(U(327684), -20) != dpp::d16(dpp::direct, 32767, -19)) +
+      (dpp::d16(U(327686), -20) != dpp::d16(dpp::direct, 3277, -18)) +
+      (dpp::rounded_t<dpp::d16, rounding::ceil>(U(327671), -20) !=
+        dpp::d16(dpp::direct, 3277, -18));
+
+    __int128 const m(__int128(dpp::d64::mmax) * 1000000 + 1);
+
+    d += (dpp::rounded_t<dpp::d64, rounding::floor>(-m, 0) !=
+        dpp::d64(dpp::direct, -922337203685477581, 7)) +
+      (dpp::rounded_t<dpp::d64, rounding::ceil>(m, 0) !=
+        dpp::d64(dpp::direct, 922337203685477581, 7)) +
+      (dpp::rounded_t<dpp::d64, rounding::toward_zero>(m, 0) !=
+        dpp::d64(dpp::direct, dpp::d64::mmax, 6));
+  }
+
+  d += exact(modes_t<dpp::d16>()) + exact(modes_t<dpp::d32>()) +
+    exact(modes_t<dpp::d64>());
+
+  std::cout << "mismatches: " << d << std::endl;
+
+  return bool(d);
+}
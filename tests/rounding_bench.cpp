@@ -0,0 +1,46 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../sqrt.hpp"
+
+template <dpp::rounding R>
+void run(char const* const n)
+{
+  using D = dpp::rounded_t<dpp::d64, R>;
+
+  std::vector<D> a, b;
+
+  {
+    std::mt19937_64 g;
+    std::uniform_real_distribution<double> x(-1000, 1000);
+
+    for (int i{}; 1000000 != i; ++i) a.emplace_back(x(g)), b.emplace_back(x(g));
+  }
+
+  D s{};
+
+  auto const t0(std::chrono::steady_clock::now());
+
+  for (std::size_t i{}; a.size() != i; ++i) s += a[i] * b[i] / 7;
+
+  auto const t1(std::chrono::steady_clock::now());
+
+  std::cout << n << ": " <<
+    std::chrono::duration<double>(t1 - t0).count() << "s " << s << ' ' <<
+    D(2) / 3 << ' ' << D(-2) / 3 << ' ' << dpp::sqrt(D(2)) << ' ' <<
+    D(1) - D(dpp::direct, 1, -30) << std::endl;
+}
+
+int main()
+{
+  run<dpp::rounding::half_up>("half_up");
+  run<dpp::rounding::half_even>("half_even");
+  run<dpp::rounding::half_down>("half_down");
+  run<dpp::rounding::toward_zero>("toward_zero");
+  run<dpp::rounding::floor>("floor");
+  run<dpp::rounding::ceil>("ceil");
+
+  return 0;
+}
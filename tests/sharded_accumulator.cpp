@@ -0,0 +1,91 @@
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../atomic.hpp"
+#include "../sharded_accumulator.hpp"
+
+using namespace dpp::literals;
+
+// g++ -std=c++20 -O2 -mcx16 sharded_accumulator.cpp -latomic
+template <typename A>
+auto run(A& a, int const n)
+{
+  auto const t0(std::chrono::steady_clock::now());
+
+  {
+    std::vector<std::jthread> t;
+
+    for (int i{}; n != i; ++i)
+      t.emplace_back(
+        [&, i]() noexcept
+        {
+          for (int j{}; 100000 != j; ++j)
+            a += dpp::d64(j % 2 ? i : -i) * .01_d64 + .0049_d64;
+        }
+      );
+  }
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+    t0).count();
+}
+
+int main()
+{
+  auto const n(8);
+
+  {
+    std::atomic<dpp::d64> a;
+    auto const t(run(a, n));
+
+    std::cout << "std::atomic: " << a.load() << ' ' << t << 's' << std::endl;
+  }
+
+  for (std::size_t s: {std::size_t(1), std::size_t(n)})
+  {
+    dpp::sharded_accumulator<dpp::d64> a(-4, s);
+    auto const t(run(a, n));
+
+    std::cout << s << " shards: " << a.load() << ' ' << t << 's' << std::endl;
+  }
+
+  //
+  dpp::sharded_accumulator<dpp::d32> a(-2);
+
+  a += 1.005_d32;
+  a -= .25_d32;
+  std::cout << a.load() << std::endl;
+
+  a += dpp::d32(dpp::nan);
+  std::cout << a.load() << std::endl;
+
+  a.clear();
+  a += dpp::d32(1e20);
+  std::cout << a.load() << std::endl;
+
+  // values are rounded to the quantum like D
+  {
+    using F = dpp::rounded_t<dpp::d64, dpp::rounding::floor>;
+    using C = dpp::rounded_t<dpp::d64, dpp::rounding::ceil>;
+    using H = dpp::rounded_t<dpp::d64, dpp::rounding::half_even>;
+
+    dpp::sharded_accumulator<F> f(-4);
+    dpp::sharded_accumulator<C> c(-4);
+    dpp::sharded_accumulator<H> h(-4);
+
+    f += F(.00015);
+    c += C(.00015);
+    h += H(.00015); h += H(.00025);
+
+    std::cout << f.load() << ' ' << c.load() << ' ' << h.load() << ' ';
+
+    // floor takes a whole quantum off for -10^-8, ceil none
+    f -= F(.00000001);
+    c -= C(.00000001);
+
+    std::cout << f.load() << ' ' << c.load() << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "../sort_key.hpp"
+
+using namespace dpp::literals;
+
+template <typename D>
+auto key(D const& a)
+{
+  std::vector<std::byte> k(dpp::sort_key_max_size_v<D>);
+  k.resize(dpp::to_sort_key(a, k));
+
+  return k;
+}
+
+int main()
+{
+  using D = dpp::d64;
+
+  std::vector<D> v{
+    1.0_d64, -1.00_d64, 0_d64, D(dpp::nan), D(dpp::direct, D::mmax, 9),
+    D(dpp::direct, D::mmin, 9), D::eps, -D::eps,
+    100_d64, 99.99_d64, -99.99_d64, 1.01_d64, 1.1_d64, 10_d64, .1_d64,
+    -.1_d64, 123456789.123456789_d64, 5_d64, 50_d64, 1.00_d64, 12.5_d64
+  };
+
+  std::sort(v.begin(), v.end(), [](auto const& a, auto const& b)
+    {
+      auto const ka(key(a)), kb(key(b));
+
+      return std::lexicographical_compare(ka.begin(), ka.end(),
+        kb.begin(), kb.end());
+    }
+  );
+
+  bool ok(true);
+
+  for (std::size_t i{}; v.size() != i; ++i)
+  {
+    auto const k(key(v[i]));
+    auto const a(dpp::from_sort_key<D>(k));
+
+    std::cout << v[i] << " " << k.size() << " " << a << std::endl;
+
+    ok = ok && ((isnan(v[i]) && isnan(a)) || (v[i] == a));
+
+    if (i && !isnan(v[i])) ok = ok && (v[i - 1] <= v[i]);
+  }
+
+  ok = ok && (key(1.0_d64) == key(1.00_d64)) && (key(1_d32) == key(10_d32 / 10));
+
+  std::cout << (ok ? "ok" : "fail") << std::endl;
+
+  return !ok;
+}
@@ -1,9 +1,141 @@
+#include <array>
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <tuple>
 
 #include "../sqrt.hpp"
 
 using namespace dpp::literals;
 
+template <typename D>
+constexpr auto roots() noexcept
+{ // sqrt, rsqrt and hypot of a few values
+  using T = typename D::sig_t;
+
+  std::array const a{D(2), D(3), D(10), D(dpp::direct, T(5), -1),
+    D(dpp::direct, T(7), -3), D(dpp::direct, T(12345), -2),
+    D(dpp::direct, T(99), -7), D(dpp::direct, T(17), 5),
+    D(dpp::direct, T(D::mmax / 3), 1), D(dpp::direct, T(D::mmax - 1), -4),
+    D::max, D(dpp::direct, T(1), D::emin + 1)};
+
+  std::array<D, 3 * std::tuple_size_v<decltype(a)>> r{};
+
+  for (std::size_t i{}; a.size() != i; ++i)
+    r[3 * i] = dpp::sqrt(a[i]), r[3 * i + 1] = dpp::rsqrt(a[i]),
+      r[3 * i + 2] = dpp::hypot(a[i], a[(i + 1) % a.size()]);
+
+  return r;
+}
+
+template <typename D>
+std::size_t agree() noexcept
+{ // constant evaluation against run time
+  constexpr auto c(roots<D>());
+  auto const r(roots<D>());
+
+  std::size_t d{};
+
+  for (std::size_t i{}; c.size() != i; ++i)
+    d += isnan(c[i]) ? !isnan(r[i]) :
+      (c[i].sig() != r[i].sig()) || (c[i].exp() != r[i].exp());
+
+  return d;
+}
+
+auto isqrt(__int128 const n) noexcept
+{
+  auto s(__int128(std::sqrt((long double)(n))));
+
+  while (s * s > n) --s;
+  while ((s + 1) * (s + 1) <= n) ++s;
+
+  return s;
+}
+
+template <typename T, typename E, dpp::rounding R>
+auto round(dpp::dpp<T, E, R>, __int128 const s, bool const x, int const e)
+  noexcept
+{ // s * 10^e of P + 1 digits, x is set if nonzero digits were cut off,
+  // rounded once to P digits, or by the constructor past mmax, to the
+  // nearest representable value
+  using D = dpp::dpp<T, E, R>;
+
+  auto const t(dpp::detail::round10<R>(s, x));
+
+  return t <= D::mmax ? D(t, e + 1) : D(10 * s + x, e - 1);
+}
+
+template <typename D>
+std::size_t exact() noexcept
+{ // sqrt and rsqrt against the roots of the values scaled to 2P + 2
+  // digits, a digit more than needed
+  constexpr int P(dpp::detail::maxpow10e<typename D::sig_t>() + 1);
+
+  auto const digits([](__int128 m) noexcept
+    {
+      int n{};
+
+      for (; m; m /= 10) ++n;
+
+      return n;
+    }
+  );
+
+  std::mt19937_64 g;
+  std::uniform_int_distribution<std::int64_t> m(1, D::mmax);
+  std::uniform_int_distribution<int> e(-20, 20);
+
+  std::size_t d{};
+
+  for (int i{}; 100000 != i; ++i)
+  {
+    D const a(dpp::direct, m(g), e(g));
+
+    {
+      auto k(2 * P + 2 - digits(a.sig()));
+
+      if ((a.exp() - k) % 2) --k;
+
+      auto const M(a.sig() * dpp::detail::pow(__int128(10), k));
+      auto const s(isqrt(M));
+
+      d += dpp::sqrt(a) != round(D{}, s, s * s != M, (a.exp() - k) / 2);
+    }
+
+    {
+      auto K(2 * P + 2 + digits(a.sig()));
+
+      if ((K + a.exp()) % 2) ++K;
+
+      auto const X(dpp::detail::pow(__int128(10), K));
+      auto const N(X / a.sig());
+      auto const q(isqrt(N));
+
+      d += dpp::rsqrt(a) != round(D{}, q, (q * q != N) || (X % a.sig()),
+        -(K + a.exp()) / 2);
+    }
+  }
+
+  return d;
+}
+
+template <typename D>
+using modes_t = std::tuple<
+  dpp::rounded_t<D, dpp::rounding::half_even>,
+  dpp::rounded_t<D, dpp::rounding::half_up>,
+  dpp::rounded_t<D, dpp::rounding::half_down>,
+  dpp::rounded_t<D, dpp::rounding::toward_zero>,
+  dpp::rounded_t<D, dpp::rounding::floor>,
+  dpp::rounded_t<D, dpp::rounding::ceil>
+>;
+
+template <typename ...D>
+std::size_t agree(std::tuple<D...>) noexcept { return (agree<D>() + ...); }
+
+template <typename ...D>
+std::size_t exact(std::tuple<D...>) noexcept { return (exact<D>() + ...); }
+
 int main()
 {
   std::cout << dpp::sqrt(2_d16) << std::endl;
@@ -21,12 +153,36 @@ int main()
   std::cout << 1 / (1 + dpp::sqrt(2_d256)) << std::endl;
   std::cout << 2 / (1 + dpp::sqrt(5_d256)) << std::endl;
 
+  //
+  std::cout << dpp::rsqrt(2_d32) << std::endl;
+  std::cout << dpp::rsqrt(2_d64) << std::endl;
+  std::cout << dpp::rsqrt(2_d128) << std::endl;
+
+  std::cout << dpp::hypot(3_d64, 4_d64) << std::endl;
+  std::cout << dpp::hypot(dpp::d64(dpp::direct, 3, 20000),
+    dpp::d64(dpp::direct, 4, 20000)) / dpp::d64(dpp::direct, 1, 20000) <<
+    std::endl;
+
   //
   std::cout << dpp::d16(std::sqrt(2_d16)) << std::endl;
   std::cout << dpp::d24(std::sqrt(2_d24)) << std::endl;
   std::cout << dpp::d32(std::sqrt(2_d32)) << std::endl;
   std::cout << dpp::d64(std::sqrt(2_d64)) << std::endl;
 
+  // every digit of the significand, at run time and in constant evaluation
+  constexpr auto c(dpp::sqrt(2_d32));
+
+  std::size_t d((dpp::sqrt(2_d32) != dpp::d32(dpp::direct, 1414213562, -9)) +
+    (c != dpp::sqrt(2_d32)));
+
+  d += agree(modes_t<dpp::d16>()) + agree(modes_t<dpp::d32>()) +
+    agree(modes_t<dpp::d64>()) +
+    agree(std::tuple<dpp::d24, dpp::d48, dpp::d96, dpp::d128>());
+
+  d += exact(modes_t<dpp::d16>()) + exact(modes_t<dpp::d32>());
+
+  std::cout << "mismatches: " << d << std::endl;
+
   //
-  return 0;
+  return bool(d);
 }
@@ -0,0 +1,610 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+
+#include "../trig.hpp"
+
+using namespace dpp::literals;
+
+struct ref_t
+{ // x = m * 10^e, sin(x), cos(x), tan(x), 40 digits, truncated, "..." if
+  // inexact
+  std::int64_t m;
+  int e;
+  char const* r[3];
+};
+
+// generated with Python's decimal module: x reduced by k pi / 2, pi to 33200
+// digits, the precision 200 digits past the integer digits of x, then the
+// Taylor series of sin(r) and cos(r) to 100 digits past the leading digit of
+// r, tan(x) = sin(x) / cos(x); among the values are those closest to
+// multiples of pi / 2 of each type, found from the continued fractions of
+// 10^e * 2 / pi
+constexpr ref_t d16_refs[]{
+  {1, 0, {"8.414709848078965066525023216302989996225...e-1",
+    "5.403023058681397174009366074429766037323...e-1",
+    "1.557407724654902230506974807458360173087...e+0"}},
+  {2, 0, {"9.092974268256816953960198659117448427022...e-1",
+    "-4.161468365471423869975682295007621897660...e-1",
+    "-2.185039863261518991643306102313682543432...e+0"}},
+  {-2, 0, {"-9.092974268256816953960198659117448427022...e-1",
+    "-4.161468365471423869975682295007621897660...e-1",
+    "2.185039863261518991643306102313682543432...e+0"}},
+  {5, -1, {"4.794255386042030002732879352155713880818...e-1",
+    "8.775825618903727161162815826038296519916...e-1",
+    "5.463024898437905132551794657802853832975...e-1"}},
+  {1, -3, {"9.999998333333416666664682539710097001513...e-4",
+    "9.999995000000416666652777778025793648037...e-1",
+    "1.000000333333466666720634942504418034314...e-3"}},
+  {1, -10, {"9.999999999999999999983333333333333333333...e-11",
+    "9.999999999999999999950000000000000000000...e-1",
+    "1.000000000000000000003333333333333333333...e-10"}},
+  {1, -127, {"9.999999999999999999999999999999999999999...e-128",
+    "9.999999999999999999999999999999999999999...e-1",
+    "1.000000000000000000000000000000000000000...e-127"}},
+  {32767, 0, {"1.875065539413894239423930657648644206485...e-1",
+    "9.822633517692822984565384182319404371233...e-1",
+    "1.908923443022148574082637486571285313212...e-1"}},
+  {-32767, 0, {"-1.875065539413894239423930657648644206485...e-1",
+    "9.822633517692822984565384182319404371233...e-1",
+    "-1.908923443022148574082637486571285313212...e-1"}},
+  {32767, 122, {"9.997094991214928785372858550885850812420...e-1",
+    "2.410222741270668361386032386926975864324...e-2",
+    "4.147788841268863281516662670672461067331...e+1"}},
+  {7, -1, {"6.442176872376910536726143513987201830658...e-1",
+    "7.648421872844884262558599901918649092682...e-1",
+    "8.422883804630794481281350022129377171872...e-1"}},
+  {8, -1, {"7.173560908995227616271746105813853661927...e-1",
+    "6.967067093471654209207499816423249261017...e-1",
+    "1.029638557050364012746361172820365284168...e+0"}},
+  {1, 5, {"3.574879797201650931647050069580882900904...e-2",
+    "-9.993608074382124518911354141448022032353...e-1",
+    "-3.577166295289877341133054456893096203777...e-2"}},
+  {1, 22, {"-8.522008497671888017727058937530293682617...e-1",
+    "5.232147853951389454975944733847094921409...e-1",
+    "-1.628778225606898878549375936939548513545...e+0"}},
+  {1, 100, {"-3.723761236612766882620866955531642957196...e-1",
+    "-9.280819050746553434561946437769559281831...e-1",
+    "4.012319619908143541857543436532949583238...e-1"}},
+  {15707, -4, {"9.999999953605742960597040875759239922982...e-1",
+    "9.632679474765222853509682323160512411846...e-5",
+    "1.038132741757139469585117897815421294270...e+4"}},
+  {15708, -4, {"9.999999999932537821342563234857847001743...e-1",
+    "-3.673205103372508597677367136963560939078...e-6",
+    "-2.722418084073540959183629856811619865557...e+5"}},
+  {31415, -4, {"9.265358966067144056617410860459685214976...e-5",
+    "-9.999999957076561522838513099870645211458...e-1",
+    "-9.265359005837250782204346053380348450235...e-5"}},
+  {31416, -4, {"-7.346410206695456711568909342689539740273...e-6",
+    "-9.999999999730151285371163168541229590289...e-1",
+    "7.346410206893698646715552525851453300702...e-6"}},
+  {4712, -3, {"-9.999999243471311171579420028344215140708...e-1",
+    "-3.889803748806969641792414414093333402087...e-4",
+    "2.570823591431413927181635176280005954803...e+3"}},
+  {4713, -3, {"-9.999998133275206608922345650285265020984...e-1",
+    "6.110195772899596612894211596049844144357...e-4",
+    "-1.636608466397747226865277293396459264907...e+3"}},
+  {6283, -3, {"-1.853071785259407500347489718825346110368...e-4",
+    "9.999999828306246459838366540016025960658...e-1",
+    "-1.853071817075493085665408902185698583148...e-4"}},
+  {6284, -3, {"8.146927302916099660161656682460164490302...e-4",
+    "9.999996681378225387486159870115322746350...e-1",
+    "8.146930006574031266226725347744971431574...e-4"}},
+  {10995, -3, {"-9.999998350969012909496098957468639958783...e-1",
+    "-5.742875327090679724689830520948371971812...e-4",
+    "1.741287731564769422234059610319393964134...e+3"}},
+  {10996, -3, {"-9.999999093844624036413445901735873584316...e-1",
+    "4.257124228649448948830933917831676258788...e-4",
+    "-2.349003354552580906501781009554621667629...e+3"}},
+  {15707, -1, {"-9.617789699063115353548406784315442016172...e-2",
+    "9.953641605615803680258518500000810178306...e-1",
+    "-9.662583886521288789898880342047081431693...e-2"}},
+  {15708, -1, {"3.673196843305710108186740094963919310703...e-3",
+    "9.999932537897194879088276746173237264372...e-1",
+    "3.673221623631190048236339596895667458432...e-3"}},
+  {19392, 1, {"8.865011491040515494643698989378290339301...e-1",
+    "-4.627263906858956782299923435323020533273...e-1",
+    "-1.915821459394174363397836327142073058680...e+0"}},
+  {19393, 1, {"-4.921049496079991885265428376100308257888...e-1",
+    "8.705358801171314037583526853068159464577...e-1",
+    "-5.652896805836262770808158828571923703056...e-1"}},
+  {15670, 6, {"9.999999999998453920216145759599190041874...e-1",
+    "5.560718989220945846869182861653980496490...e-7",
+    "1.798328600920624706025162811106326793762...e+6"}},
+  {-1567, 7, {"-9.999999999998453920216145759599190041874...e-1",
+    "5.560718989220945846869182861653980496490...e-7",
+    "-1.798328600920624706025162811106326793762...e+6"}},
+  {24307, -3, {"-7.350505463228592473216797439314729170304...e-1",
+    "6.780123113561184825735723742340984954565...e-1",
+    "-1.084125662633848637337567333788483487235...e+0"}},
+  {25427, -5, {"2.515389472804788287942069962217998629543...e-1",
+    "9.678471769866503528685589163320806458742...e-1",
+    "2.598953153571561634521765328438014033153...e-1"}},
+  {-12183, 38, {"-9.212262534514020444663363316344361054129...e-1",
+    "3.890272354885878202293386082807818551687...e-1",
+    "-2.368025087740743469023957093719530798212...e+0"}},
+  {-18807, -5, {"-1.869632762391983313294025886086029742694...e-1",
+    "9.823669036250688024624522922771430887141...e-1",
+    "-1.903191929097755254196188649692117865927...e-1"}},
+  {9159, -6, {"9.158871946602657246336542164437898271269...e-3",
+    "9.999580566527106765095951978809904086794...e-1",
+    "9.159256116462861908515310672315495440436...e-3"}},
+  {-4548, 1, {"-7.425342549812380160777730923433500888177...e-1",
+    "-6.698080920528340455648616001074834002577...e-1",
+    "1.108577611693988576103000335354621926291...e+0"}},
+  {-59, -8, {"-5.899999999999657701666666672624369158333...e-7",
+    "9.999999999998259500000000050489004166666...e-1",
+    "-5.900000000000684596666666761989906533346...e-7"}},
+  {-28588, 49, {"4.142791688709663652248232388364974103330...e-1",
+    "-9.101498614182069593173693409821226854733...e-1",
+    "-4.551768740869018588592136544338556782425...e-1"}},
+  {-17670, 2, {"9.766737157545482506689055660285171684369...e-1",
+    "2.147287892999070774008095719826835838408...e-1",
+    "4.548406009920025662704747986643920098538...e+0"}},
+  {-31673, -2, {"-5.403542116293271942620547689526600862114...e-1",
+    "-8.414376542409118260788434545057827822311...e-1",
+    "6.421797371509339432463662556622435369822...e-1"}},
+  {13596, 12, {"-9.339678867687511468394020476804521588430...e-2",
+    "9.956289669675381297757897623946662008692...e-1",
+    "-9.380682139184913805958809579373680636754...e-2"}},
+  {-10875, -25, {"-1.087499999999999999999999999999999999999...e-21",
+    "9.999999999999999999999999999999999999999...e-1",
+    "-1.087500000000000000000000000000000000000...e-21"}},
+  {-10157, 53, {"-3.594062690313998070089729721609203077763...e-2",
+    "9.993539269637205416409924413662963894024...e-1",
+    "-3.596386218477803624166780162483939738130...e-2"}},
+  {6055, -1, {"7.361621161952177097183913766304388121105...e-1",
+    "-6.768052442756178728366910482393144046203...e-1",
+    "-1.087701554356496270034059298189547628790...e+0"}},
+  {-8395, 66, {"6.666646442795120024147371235218799760965...e-1",
+    "-7.453578013730531315762056885715038445702...e-1",
+    "-8.944223070469278684308908131584605140080...e-1"}},
+  {-17992, 68, {"-9.440306725635342122726785798466001253880...e-1",
+    "-3.298576803096166403841679745795964141127...e-1",
+    "2.861933278853571168845878354048166612658...e+0"}},
+  {-14839, -8, {"-1.483899994554187886464061406456104138764...e-4",
+    "9.999999889902039702026014956041656018783...e-1",
+    "-1.483900010891624334994983408601581824246...e-4"}},
+  {-24764, 93, {"-4.783573432060560306494064840127237762171...e-1",
+    "-8.781652761302074623817360028105475966237...e-1",
+    "5.447235915703969990400302390829404104619...e-1"}},
+  {29253, 39, {"1.056463375355303717377685145026682674863...e-1",
+    "9.944037667694792005988952804156093595493...e-1",
+    "1.062408863139605401152352874965146082840...e-1"}},
+  {-19326, -3, {"-4.586221783394852160780633948888709284875...e-1",
+    "8.886313620029091779295637893411354975445...e-1",
+    "-5.160994738085597646050669634908806284000...e-1"}},
+};
+
+constexpr ref_t d32_refs[]{
+  {1, 0, {"8.414709848078965066525023216302989996225...e-1",
+    "5.403023058681397174009366074429766037323...e-1",
+    "1.557407724654902230506974807458360173087...e+0"}},
+  {2, 0, {"9.092974268256816953960198659117448427022...e-1",
+    "-4.161468365471423869975682295007621897660...e-1",
+    "-2.185039863261518991643306102313682543432...e+0"}},
+  {-2, 0, {"-9.092974268256816953960198659117448427022...e-1",
+    "-4.161468365471423869975682295007621897660...e-1",
+    "2.185039863261518991643306102313682543432...e+0"}},
+  {5, -1, {"4.794255386042030002732879352155713880818...e-1",
+    "8.775825618903727161162815826038296519916...e-1",
+    "5.463024898437905132551794657802853832975...e-1"}},
+  {1, -3, {"9.999998333333416666664682539710097001513...e-4",
+    "9.999995000000416666652777778025793648037...e-1",
+    "1.000000333333466666720634942504418034314...e-3"}},
+  {1, -10, {"9.999999999999999999983333333333333333333...e-11",
+    "9.999999999999999999950000000000000000000...e-1",
+    "1.000000000000000000003333333333333333333...e-10"}},
+  {1, -32767, {"9.999999999999999999999999999999999999999...e-32768",
+    "9.999999999999999999999999999999999999999...e-1",
+    "1.000000000000000000000000000000000000000...e-32767"}},
+  {2147483647, 0, {"-7.249165551445563905482932963397950398740...e-1",
+    "-6.888366918779438346797582230379290318611...e-1",
+    "1.052377963735133913669813928474702635000...e+0"}},
+  {-2147483647, 0, {"7.249165551445563905482932963397950398740...e-1",
+    "-6.888366918779438346797582230379290318611...e-1",
+    "-1.052377963735133913669813928474702635000...e+0"}},
+  {2147483647, 32757, {"-9.902500373972214131121464038750404945351...e-1",
+    "1.393013403912596699577351390029776810410...e-1",
+    "-7.108689942364357244738613144866098475809...e+0"}},
+  {7, -1, {"6.442176872376910536726143513987201830658...e-1",
+    "7.648421872844884262558599901918649092682...e-1",
+    "8.422883804630794481281350022129377171872...e-1"}},
+  {8, -1, {"7.173560908995227616271746105813853661927...e-1",
+    "6.967067093471654209207499816423249261017...e-1",
+    "1.029638557050364012746361172820365284168...e+0"}},
+  {1, 5, {"3.574879797201650931647050069580882900904...e-2",
+    "-9.993608074382124518911354141448022032353...e-1",
+    "-3.577166295289877341133054456893096203777...e-2"}},
+  {1, 22, {"-8.522008497671888017727058937530293682617...e-1",
+    "5.232147853951389454975944733847094921409...e-1",
+    "-1.628778225606898878549375936939548513545...e+0"}},
+  {1, 300, {"-9.857504251603769966090475314298954690777...e-1",
+    "-1.682144443742450728518756644355558445330...e-1",
+    "5.860081925944898104682611487864776719335...e+0"}},
+  {1570796326, -9, {"9.999999999999999996840696823673075889040...e-1",
+    "7.948966192313216915560407949656164273650...e-10",
+    "1.258025227188683609321793915420101956529...e+9"}},
+  {1570796327, -9, {"9.999999999999999999789663015986292805272...e-1",
+    "-2.051033807686783083588105303506853406782...e-10",
+    "-4.875590037825021203709855758702270894889...e+9"}},
+  {314159265, -8, {"3.589793238462643375569455355813263836949...e-9",
+    "-9.999999999999999935566922525439435959101...e-1",
+    "-3.589793238462643398699597940964980613647...e-9"}},
+  {314159266, -8, {"-6.410206761537356572820462426091674645429...e-9",
+    "-9.999999999999999794546246371703774921378...e-1",
+    "6.410206761537356704520566495225144134512...e-9"}},
+  {471238898, -8, {"-9.999999999999999999260068566936984498264...e-1",
+    "-3.846898576939650749097661890394773298048...e-10",
+    "2.599496659450628837148321919717988982630...e+9"}},
+  {471238899, -8, {"-9.999999999999999537729054336333495551754...e-1",
+    "9.615310142306034776918128595929094932659...e-9",
+    "-1.040008055070567364399266452014956421415...e+8"}},
+  {628318530, -8, {"-7.179586476925286704878625541323094418569...e-9",
+    "9.999999999999999742267690101757744666730...e-1",
+    "-7.179586476925286889919766222536830420576...e-9"}},
+  {628318531, -8, {"2.820413523074713229701721740032320962802...e-9",
+    "9.999999999999999960226337794286420241897...e-1",
+    "2.820413523074713240919539214752341704914...e-9"}},
+  {1099557428, -8, {"-9.999999999999999713908617667595683089421...e-1",
+    "-7.564276334619251769342450997506282391345...e-9",
+    "1.322003527850143012796292485789491714539...e+8"}},
+  {1099557429, -8, {"-9.999999999999999970336251129520865887775...e-1",
+    "2.435723665380748156113316734385324948272...e-9",
+    "-4.105556037464872715457073709276621981748...e+8"}},
+  {1570796326, -6, {"-7.948966192312379809926184764709326983213...e-7",
+    "9.999999999996840696823673242242150460654...e-1",
+    "-7.948966192314891129340174209580051107530...e-7"}},
+  {1570796327, -6, {"2.051033807686768703326978279448057944582...e-7",
+    "9.999999999999789663015986293542632756655...e-1",
+    "2.051033807686811844153500178690789800516...e-7"}},
+  {1939242313, -4, {"-2.079075702232423064868215228549016135637...e-5",
+    "9.999999997838722111959822345754543110904...e-1",
+    "-2.079075702681769099244985452514250435492...e-5"}},
+  {1939242314, -4, {"7.920924289335010894859703494747549689488...e-5",
+    "9.999999968629479152105847391861950017389...e-1",
+    "7.920924314183363028127791773631858501532...e-5"}},
+  {1248224789, 30401, {"-1.424910374080792993826714967504637203431...e-15",
+    "9.999999999999999999999999999989848152129...e-1",
+    "-1.424910374080792993826714967506083750766...e-15"}},
+  {2115519521, 14150, {"-9.999999999999999999999999999659226356928...e-1",
+    "8.255587720703556743679871825514939728397...e-15",
+    "-1.211300798721060788926482707184281187458...e+14"}},
+  {-1248224789, 30402, {"1.424910374080792993826714967456901141386...e-14",
+    "9.999999999999999999999999998984815212918...e-1",
+    "1.424910374080792993826714967601555874858...e-14"}},
+  {-921032233, 2, {"6.295065898120926793609815379684936832999...e-1",
+    "7.769951437320246812223901963905321015104...e-1",
+    "8.101808549130406820455238939867302558127...e-1"}},
+  {1746594093, 2, {"-6.156585405507555648423238634008056430041...e-1",
+    "-7.880130464953696855139859591689986879627...e-1",
+    "7.812796289209320029014825825192677421280...e-1"}},
+  {-1118128940, 2, {"6.357709127687061073410504450359286233458...e-2",
+    "-9.979769303269351941776452173517784358054...e-1",
+    "-6.370597289863492747694481349539560099250...e-2"}},
+  {-2045261764, 2890, {"-4.829798930745523452649714747033805447961...e-1",
+    "8.756314423806936271319756646404269268431...e-1",
+    "-5.515789745528230412638855038592451054193...e-1"}},
+  {-1295341973, 24978, {"-3.961556989018710372518466547104061587113...e-1",
+    "-9.181833489165277248142965315689189966450...e-1",
+    "4.314559824781636829179549710691619245577...e-1"}},
+  {1775643056, -5, {"1.483325047244420065795601162694109371196...e-1",
+    "9.889375450665089344915603776607713795117...e-1",
+    "1.499917820538062522165351855051401981007...e-1"}},
+  {1421304154, 8684, {"-8.495155753830256288383763932989641407682...e-1",
+    "5.275635385255949435348406463829411396186...e-1",
+    "-1.610262107493638059903154637505825063617...e+0"}},
+  {-2081745232, 1, {"-9.346766546443003292045982330101225876284...e-1",
+    "-3.554990172460949741250756170287768294304...e-1",
+    "2.629196170174693804387394557794653150622...e+0"}},
+  {-506062962, 12746, {"4.643057710389838935809179666331680059257...e-1",
+    "-8.856749691505878080452239998546666291821...e-1",
+    "-5.242394639246486617346208889551209004266...e-1"}},
+  {1657976512, 20572, {"5.965570275377602239310848052826179662338...e-1",
+    "8.025706902792500993142852718319469154921...e-1",
+    "7.433077668587566488563112222682628300721...e-1"}},
+  {1009261424, -11, {"1.009244290047458980578936669282789461903...e-2",
+    "9.999490700012179420542721184970548657499...e-1",
+    "1.009295693475898444416430759923311793706...e-2"}},
+  {-2082594525, 0, {"-6.367837440555477783499888611588828292648...e-1",
+    "7.710424523374822709151195104392612708917...e-1",
+    "-8.258737792258810930524308648515975368440...e-1"}},
+  {-1066447890, -4, {"-2.809475098296412098934858109876799685068...e-1",
+    "9.597231354513256995421698300164333494488...e-1",
+    "-2.927380819026739313688926471893657107115...e-1"}},
+  {-825533220, -2, {"4.455971596142880166179945655505347603033...e-1",
+    "8.952335847943142981811262651262646017609...e-1",
+    "4.977440158443864054129423568579706804570...e-1"}},
+  {-948223181, 12482, {"-9.264046326135262183388715995475447377195...e-1",
+    "-3.765294897776235462048222321976630874502...e-1",
+    "2.460377361573076815320436920789715471934...e+0"}},
+  {2084104176, 0, {"-1.803493922491741566921040144926648583786...e-1",
+    "-9.836026111775799472655681174970540268842...e-1",
+    "1.833559510718031395810773473164385850055...e-1"}},
+  {308192273, 7800, {"-9.109347033270635079389225992706912585286...e-1",
+    "4.125505620823159076841741799682077656303...e-1",
+    "-2.208055901631047547036829161449175086546...e+0"}},
+  {649764193, -8, {"2.128165301529517206794211208931179504704...e-1",
+    "9.770921780946042304017955816738308756802...e-1",
+    "2.178059910048183320156615473950358291371...e-1"}},
+  {1659681332, 21469, {"9.583730083604212431563182139766774857465...e-1",
+    "-2.855191356918060474123051654268030596456...e-1",
+    "-3.356598169990625428392835546917929434930...e+0"}},
+  {-10755826, 21705, {"-8.848746210011271940084512331623495626541...e-1",
+    "4.658292660493880007267684672852291632770...e-1",
+    "-1.899568544727954686601593828038492412900...e+0"}},
+};
+
+constexpr ref_t d64_refs[]{
+  {1, 0, {"8.414709848078965066525023216302989996225...e-1",
+    "5.403023058681397174009366074429766037323...e-1",
+    "1.557407724654902230506974807458360173087...e+0"}},
+  {2, 0, {"9.092974268256816953960198659117448427022...e-1",
+    "-4.161468365471423869975682295007621897660...e-1",
+    "-2.185039863261518991643306102313682543432...e+0"}},
+  {-2, 0, {"-9.092974268256816953960198659117448427022...e-1",
+    "-4.161468365471423869975682295007621897660...e-1",
+    "2.185039863261518991643306102313682543432...e+0"}},
+  {5, -1, {"4.794255386042030002732879352155713880818...e-1",
+    "8.775825618903727161162815826038296519916...e-1",
+    "5.463024898437905132551794657802853832975...e-1"}},
+  {1, -3, {"9.999998333333416666664682539710097001513...e-4",
+    "9.999995000000416666652777778025793648037...e-1",
+    "1.000000333333466666720634942504418034314...e-3"}},
+  {1, -10, {"9.999999999999999999983333333333333333333...e-11",
+    "9.999999999999999999950000000000000000000...e-1",
+    "1.000000000000000000003333333333333333333...e-10"}},
+  {1, -32767, {"9.999999999999999999999999999999999999999...e-32768",
+    "9.999999999999999999999999999999999999999...e-1",
+    "1.000000000000000000000000000000000000000...e-32767"}},
+  {9223372036854775807, 0, {"5.303352662202237992215656988621053012452...e-1",
+    "8.477880073480187828081561487482376787246...e-1",
+    "6.255517436241817971623632511435431061986...e-1"}},
+  {-9223372036854775807, 0, {"-5.303352662202237992215656988621053012452...e-1",
+    "8.477880073480187828081561487482376787246...e-1",
+    "-6.255517436241817971623632511435431061986...e-1"}},
+  {9223372036854775807, 32748, {"7.815405128456529181309255804147741614093...e-1",
+    "6.238544916733018329837273395975949397744...e-1",
+    "1.252760897416007717111053663298577042478...e+0"}},
+  {7, -1, {"6.442176872376910536726143513987201830658...e-1",
+    "7.648421872844884262558599901918649092682...e-1",
+    "8.422883804630794481281350022129377171872...e-1"}},
+  {8, -1, {"7.173560908995227616271746105813853661927...e-1",
+    "6.967067093471654209207499816423249261017...e-1",
+    "1.029638557050364012746361172820365284168...e+0"}},
+  {1, 5, {"3.574879797201650931647050069580882900904...e-2",
+    "-9.993608074382124518911354141448022032353...e-1",
+    "-3.577166295289877341133054456893096203777...e-2"}},
+  {1, 22, {"-8.522008497671888017727058937530293682617...e-1",
+    "5.232147853951389454975944733847094921409...e-1",
+    "-1.628778225606898878549375936939548513545...e+0"}},
+  {1, 300, {"-9.857504251603769966090475314298954690777...e-1",
+    "-1.682144443742450728518756644355558445330...e-1",
+    "5.860081925944898104682611487864776719335...e+0"}},
+  {1570796326794896619, -18, {"9.999999999999999999999999999999999999732...e-1",
+    "2.313216916397514420985846996875529104854...e-19",
+    "4.322984121858095330420179669111893302437...e+18"}},
+  {1570796326794896620, -18, {"9.999999999999999999999999999999999997045...e-1",
+    "-7.686783083602485579014153003124470894368...e-19",
+    "-1.300934329906107203075751195681677709772...e+18"}},
+  {3141592653589793238, -18, {"4.626433832795028841971693993751058209584...e-19",
+    "-9.999999999999999999999999999999999998929...e-1",
+    "-4.626433832795028841971693993751058210079...e-19"}},
+  {3141592653589793239, -18, {"-5.373566167204971158028306006248941789991...e-19",
+    "-9.999999999999999999999999999999999998556...e-1",
+    "5.373566167204971158028306006248941790767...e-19"}},
+  {4712388980384689857, -18, {"-9.999999999999999999999999999999999997592...e-1",
+    "-6.939650749192543262957540990626587314067...e-19",
+    "1.440994707286031776806726556370631100606...e+18"}},
+  {4712388980384689858, -18, {"-9.999999999999999999999999999999999999531...e-1",
+    "3.060349250807456737042459009373412685328...e-19",
+    "-3.267600911027247504651625076481950143996...e+18"}},
+  {6283185307179586476, -18, {"-9.252867665590057683943387987502116418178...e-19",
+    "9.999999999999999999999999999999999995719...e-1",
+    "-9.252867665590057683943387987502116422139...e-19"}},
+  {6283185307179586477, -18, {"7.471323344099423160566120124978835805004...e-20",
+    "9.999999999999999999999999999999999999972...e-1",
+    "7.471323344099423160566120124978835805024...e-20"}},
+  {1099557428756427633, -17, {"-9.999999999999999999999999999999999893312...e-1",
+    "-4.619251841478260094690092897812870356985...e-18",
+    "2.164852738749958388375157213875215758237...e+17"}},
+  {1099557428756427634, -17, {"-9.999999999999999999999999999999999855237...e-1",
+    "5.380748158521739905309907102187129600623...e-18",
+    "-1.858477614151581718679644565259539567818...e+17"}},
+  {1570796326794896619, -15, {"-2.313216916397514420985846996875508474941...e-16",
+    "9.999999999999999999999999999999732451374...e-1",
+    "-2.313216916397514420985846996875570364741...e-16"}},
+  {1570796326794896620, -15, {"7.686783083602485579014153003123713918225...e-16",
+    "9.999999999999999999999999999997045668291...e-1",
+    "7.686783083602485579014153003125984848925...e-16"}},
+  {1939242313207907570, -13, {"-2.382205076307715403572287268237340244535...e-14",
+    "9.999999999999999999999999997162549487206...e-1",
+    "-2.382205076307715403572287268913279146070...e-14"}},
+  {1939242313207907571, -13, {"7.617794923692284596427712724169567957542...e-14",
+    "9.999999999999999999999999970984600250284...e-1",
+    "7.617794923692284596427712746272904449771...e-14"}},
+  {5155093316265370499, 7284, {"9.999999999999999999999999999999999999999...e-1",
+    "-1.141696936767386369489581365970320559371...e-24",
+    "-8.758891854710684604010973677175782997163...e+23"}},
+  {2468703309108240675, 28852, {"9.999999999999999999999999999999999999999...e-1",
+    "-1.397651004071532633093279594130324516961...e-24",
+    "-7.154861958291981368407785846947292127100...e+23"}},
+  {-7386660582042350751, 27316, {"9.999999999999999999999999999999999999999...e-1",
+    "-2.120432980101756061796482046868171770236...e-24",
+    "-4.716017951918535329445431857306415429103...e+23"}},
+  {-8258708663123833671, -6, {"-1.050833246668206322710330180739956222936...e-1",
+    "9.944634205826615352599958592746374146309...e-1",
+    "-1.056683659668967410871139595239914036423...e-1"}},
+  {9194013437206728333, -6, {"-9.987748884863125601477155931249971499077...e-1",
+    "4.948456455455488975221806678881289184168...e-2",
+    "-2.018356425841032585470831540405614030320...e+1"}},
+  {2402109126748413561, 21415, {"9.817290484309709001425877416714995656599...e-1",
+    "-1.902841965766479325912326142242588491520...e-1",
+    "-5.159277891138599710896956139855547839726...e+0"}},
+  {-3002205164250005417, -13, {"4.773794709450042841202148973638131656709...e-1",
+    "-8.786972406467814841927609825658302857495...e-1",
+    "-5.432809491852053905080614506903112168243...e-1"}},
+  {-1868212727904689138, 29819, {"-3.960903847503568402545911210732745672274...e-1",
+    "9.182115263425493971269803103044911703304...e-1",
+    "-4.313716103391526749308303780183303277860...e-1"}},
+  {-908423481049567047, -9, {"-4.269994906457650078644080591338369892363...e-1",
+    "-9.042518647966711500814811549239198772854...e-1",
+    "4.722130053243291183630252338469695384964...e-1"}},
+  {7865659871980626854, 28816, {"9.961480087817810731564208627964233299451...e-1",
+    "-8.768776767652725435115366779660122048185...e-2",
+    "-1.136017069628784118811434739142555527679...e+1"}},
+  {-5875959333883090600, -9, {"-6.156116420013778365910078283777250823931...e-1",
+    "-7.880496851292863828064896120491509610575...e-1",
+    "7.811837928726301181167929526286664330598...e-1"}},
+  {-1766399490789041591, 8785, {"9.850664393035626071187412100851995947197...e-1",
+    "1.721746501602387635640449225492311876430...e-1",
+    "5.721320986491247151019978862008649474866...e+0"}},
+  {-6505796388206825711, 416, {"5.339884790186814082076909397862646431584...e-1",
+    "8.454917529315796025784320406771349254952...e-1",
+    "6.315714815279739103191032331337318428824...e-1"}},
+  {1104948345959945628, 31430, {"9.869056147969853143644491102371423266787...e-1",
+    "1.612988142615575501154730091329462130536...e-1",
+    "6.118492682758642961024192370012439920446...e+0"}},
+  {8266660583087346670, -5, {"-9.303937764041233371422935101657022162545...e-1",
+    "3.665616194154458236351936228685300916268...e-1",
+    "-2.538164737180663198081488540419149042486...e+0"}},
+  {-238722640711161195, 24642, {"-2.859652984189330021210110237128633258167...e-1",
+    "9.582399741714862284632411474970788371714...e-1",
+    "-2.984276445638624243884711773993840776197...e-1"}},
+  {-6504607159559491059, -2, {"7.532835308357726123150235339757913587971...e-1",
+    "-6.576959192298456187354648407355516884591...e-1",
+    "-1.145337090912558786902780089292703107041...e+0"}},
+  {4143582679425684562, -10, {"-3.331501505138508935233704111197754938072...e-1",
+    "-9.428737864701714652426482299915088128316...e-1",
+    "3.533348315484114414153301254439563896043...e-1"}},
+  {2777871642189071831, -13, {"9.516622449615169905758872582670112313859...e-1",
+    "3.071464984576669877494005550593910016874...e-1",
+    "3.098398483265410012561808838673272334220...e+0"}},
+  {-6340792380860397563, 2, {"8.270946458915696546197615450534395734821...e-1",
+    "-5.620626715389476923238248335111110176865...e-1",
+    "-1.471534559708359460666238741938440995961...e+0"}},
+  {4323158722882046719, -6, {"-1.444068826728871071911199281180106437087...e-1",
+    "-9.895183940870927627064904150962883172364...e-1",
+    "1.459365318884381359455072585551245039567...e-1"}},
+  {-5985558866162650820, -14, {"-9.231392235495308061073190402485537945545...e-1",
+    "-3.844658293585652170410423801422400847118...e-1",
+    "2.401095632060922193584844277530764640062...e+0"}},
+  {-3967071931237123625, -13, {"5.318646723248506998238701499929785920645...e-1",
+    "8.468293631734667206165328784597628642809...e-1",
+    "6.280659309352528467456577908427162087183...e-1"}},
+};
+
+template <typename D>
+D expected(std::string_view s) noexcept
+{ // s rounded once by the constructor: the digits that fit sig2_t, and a
+  // sticky digit, if any digit beyond them is nonzero, or if s is inexact
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  constexpr int L(dpp::detail::maxpow10e<U>());
+
+  if ("0" == s) return {};
+
+  bool const neg('-' == s.front());
+
+  if (neg) s.remove_prefix(1);
+
+  auto const p(s.find('e'));
+
+  U m{};
+  F e(std::atoi(s.data() + p + 1) + 1);
+  bool x(s.substr(0, p).ends_with("..."));
+
+  for (int n{}; auto const c: s.substr(0, p))
+  {
+    if (('0' > c) || ('9' < c)) continue;
+    else if (L > n++) m = U(10) * m + U(c - '0'), --e;
+    else x = x || ('0' != c);
+  }
+
+  if (x && !(m % U(10))) ++m;
+
+  return D(neg ? -m : m, e);
+}
+
+template <typename D, std::size_t N>
+std::size_t check(ref_t const (&refs)[N]) noexcept
+{ // sin, cos and tan against the references, correctly rounded
+  using T = typename D::sig_t;
+
+  std::size_t d{};
+
+  for (auto const& [m, e, r]: refs)
+  {
+    D const x(dpp::direct, T(m), e);
+
+    D const y[]{dpp::sin(x), dpp::cos(x), dpp::tan(x)};
+
+    for (std::size_t i{}; 3 != i; ++i)
+    {
+      if (auto const z(expected<D>(r[i])); isnan(y[i]) || (y[i] != z))
+      {
+        ++d;
+
+        std::cout << (char const*[]){"sin", "cos", "tan"}[i] << '(' << x <<
+          ") = " << y[i] << ", expected " << z << std::endl;
+      }
+    }
+  }
+
+  return d;
+}
+
+template <typename D>
+using modes_t = std::tuple<
+  dpp::rounded_t<D, dpp::rounding::half_even>,
+  dpp::rounded_t<D, dpp::rounding::half_up>,
+  dpp::rounded_t<D, dpp::rounding::half_down>,
+  dpp::rounded_t<D, dpp::rounding::toward_zero>,
+  dpp::rounded_t<D, dpp::rounding::floor>,
+  dpp::rounded_t<D, dpp::rounding::ceil>
+>;
+
+template <typename ...D, std::size_t N>
+std::size_t check(std::tuple<D...>, ref_t const (&refs)[N]) noexcept
+{
+  return (check<D>(refs) + ...);
+}
+
+int main()
+{
+  std::cout << dpp::sin(1_d32) << ' ' << dpp::sin(1_d64) << ' ' <<
+    dpp::cos(1_d64) << ' ' << dpp::tan(1_d64) << std::endl;
+  std::cout << dpp::sin(1_d128) << std::endl;
+  std::cout << dpp::sin(1000000_d64) << ' ' <<
+    dpp::cos(dpp::d64(dpp::direct, 1, 22)) << ' ' <<
+    dpp::sin(dpp::d64(dpp::direct, 1, 300)) << std::endl;
+  std::cout << dpp::sin(dpp::d64::max) << ' ' << dpp::cos(dpp::d64::max) <<
+    ' ' << dpp::sin(dpp::d32::max) << ' ' << dpp::cos(dpp::d32::min) <<
+    std::endl;
+
+  std::cout << dpp::atan(1_d64) << ' ' << dpp::atan(10_d64) << ' ' <<
+    dpp::atan(-.3_d64) << std::endl;
+  std::cout << dpp::atan2(-1_d64, -1_d64) << ' ' << dpp::atan2(1_d64, 0_d64) <<
+    ' ' << dpp::atan2(0_d64, -1_d64) << std::endl;
+
+
+  // correctly rounded in every mode, at run time and in constant evaluation
+  constexpr auto c0(dpp::sin(1_d64));
+  constexpr auto c1(dpp::cos(dpp::d32(dpp::direct, 1, 22)));
+  constexpr auto c2(dpp::tan(3_d16));
+
+  std::size_t d((c0 != dpp::sin(1_d64)) +
+    (c1 != dpp::cos(dpp::d32(dpp::direct, 1, 22))) + (c2 != dpp::tan(3_d16)));
+
+  d += check(modes_t<dpp::d16>(), d16_refs) +
+    check(modes_t<dpp::d32>(), d32_refs) +
+    check(modes_t<dpp::d64>(), d64_refs);
+
+  std::cout << "mismatches: " << d << std::endl;
+
+  //
+  return bool(d);
+}
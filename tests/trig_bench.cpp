@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../trig.hpp"
+
+template <typename D>
+void run(int const lo, int const hi)
+{
+  std::vector<D> a;
+
+  {
+    std::mt19937_64 g;
+    std::uniform_real_distribution<double> x(lo, hi);
+
+    for (int i{}; 1000000 != i; ++i) a.emplace_back(x(g));
+  }
+
+  auto const bench(
+    [&](char const* const n, auto const f, auto const g)
+    {
+      std::vector<D> r0(a.size()), r1(a.size());
+
+      auto const t0(std::chrono::steady_clock::now());
+
+      for (std::size_t i{}; a.size() != i; ++i) r0[i] = f(a[i]);
+
+      auto const t1(std::chrono::steady_clock::now());
+
+      for (std::size_t i{}; a.size() != i; ++i) r1[i] = g(a[i]);
+
+      auto const t2(std::chrono::steady_clock::now());
+
+      std::size_t d{};
+
+      for (std::size_t i{}; a.size() != i; ++i) d += r0[i] != r1[i];
+
+      std::cout << n << " double: " <<
+        std::chrono::duration<double>(t1 - t0).count() << "s dpp: " <<
+        std::chrono::duration<double>(t2 - t1).count() << "s differing: " <<
+        d << std::endl;
+    }
+  );
+
+  bench(
+    "sin",
+    [](D const& x) noexcept { return D(std::sin(double(x))); },
+    [](D const& x) noexcept { return dpp::sin(x); }
+  );
+
+  bench(
+    "sin + cos",
+    [](D const& x) noexcept
+    {
+      return D(std::sin(double(x))) + D(std::cos(double(x)));
+    },
+    [](D const& x) noexcept
+    {
+      auto const [s, c](dpp::sincos(x)); return s + c;
+    }
+  );
+
+  bench(
+    "atan",
+    [](D const& x) noexcept { return D(std::atan(double(x))); },
+    [](D const& x) noexcept { return dpp::atan(x); }
+  );
+}
+
+int main()
+{
+  run<dpp::d32>(-10, 10);
+  run<dpp::d64>(-10, 10);
+
+  return 0;
+}
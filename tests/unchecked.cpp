@@ -0,0 +1,101 @@
+#include <chrono>
+#include <iostream>
+
+#include "../unchecked.hpp"
+
+using namespace dpp::literals;
+
+static constexpr auto max_iter = 100u;
+
+template <typename D>
+constexpr auto julia(D zr, D zi, D const cr, D const ci) noexcept
+{
+  unsigned j{};
+
+  for (; max_iter != j; ++j)
+  {
+    if (auto const zr2(zr * zr), zi2(zi * zi); zr2 + zi2 <= 4)
+    {
+      zi = fma(zr + zr, zi, ci); // zi = 2 * zr * zi + ci;
+      zr = zr2 - zi2 + cr;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return j;
+}
+
+template <typename D>
+constexpr auto julia_unchecked(D zr, D zi, D const cr, D const ci, bool& s)
+  noexcept
+{
+  using namespace dpp::unchecked;
+
+  unsigned j{};
+
+  for (; max_iter != j; ++j)
+  {
+    if (auto const zr2(mul(zr, zr, s)), zi2(mul(zi, zi, s));
+      add(zr2, zi2, s) <= 4)
+    {
+      zi = fma(add(zr, zr, s), zi, ci, s);
+      zr = add(sub(zr2, zi2, s), cr, s);
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return j;
+}
+
+template <typename D>
+void run(char const* const n)
+{
+  constexpr int w(400), h(300);
+
+  D const cr(-.835), ci(-.2321);
+
+  auto const t0(std::chrono::steady_clock::now());
+
+  std::size_t a{};
+
+  for (int y{}; h != y; ++y)
+    for (int x{}; w != x; ++x)
+      a += julia(D(3 * x) / w - D(1.5), D(2 * y) / h - 1, cr, ci);
+
+  auto const t1(std::chrono::steady_clock::now());
+
+  std::size_t b{};
+  bool s{};
+
+  for (int y{}; h != y; ++y)
+    for (int x{}; w != x; ++x)
+      b += julia_unchecked(D(3 * x) / w - D(1.5), D(2 * y) / h - 1, cr, ci,
+        s);
+
+  auto const t2(std::chrono::steady_clock::now());
+
+  std::cout << n << " checked: " <<
+    std::chrono::duration<double>(t1 - t0).count() << "s unchecked: " <<
+    std::chrono::duration<double>(t2 - t1).count() << "s iterations: " <<
+    a << ' ' << b << " flag: " << s << std::endl;
+}
+
+int main()
+{
+  run<dpp::d32>("d32");
+  run<dpp::d64>("d64");
+
+  //
+  bool s{};
+
+  std::cout << dpp::unchecked::mul(dpp::d16::max, dpp::d16::max, s) << ' ' <<
+    s << std::endl;
+
+  return 0;
+}
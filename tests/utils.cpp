@@ -1,15 +1,62 @@
 #include <iostream>
+#include <random>
 
 #include "../utils.hpp"
 
 using namespace dpp::literals;
 
+template <typename D, auto ...B>
+auto div() noexcept
+{ // div<B>() against operator/, on random operands
+  using T = typename D::sig_t;
+
+  std::mt19937_64 g;
+  std::uniform_int_distribution<T> m(D::mmin, D::mmax);
+  std::uniform_int_distribution<int> e(-20, 20);
+
+  std::size_t d{};
+
+  for (int i{}; 100000 != i; ++i)
+  {
+    D const a(dpp::direct, m(g), e(g));
+
+    d += ((dpp::div<B>(a) != a / B) + ...);
+  }
+
+  return d;
+}
+
+template <dpp::rounding R>
+auto div() noexcept
+{
+  return div<dpp::rounded_t<dpp::d32, R>, 3, -7, 365, 1000003>() +
+    div<dpp::rounded_t<dpp::d64, R>, 3, -7, 365, 1000000007>();
+}
+
 int main()
 {
-  std::cout << dpp::div<3>(1_d32) << std::endl;
+  std::cout << dpp::div<3>(1_d32) << ' ' << 1_d32 / 3 << std::endl;
+  std::cout << dpp::div<-7>(100_d64) << ' ' << 100_d64 / -7 << std::endl;
+  std::cout << dpp::div<365>(.05_d64) << ' ' << .05_d64 / 365 << std::endl;
+  std::cout << div<dpp::rounding::half_even>() << ' ' <<
+    div<dpp::rounding::half_up>() << ' ' <<
+    div<dpp::rounding::half_down>() << ' ' <<
+    div<dpp::rounding::toward_zero>() << ' ' <<
+    div<dpp::rounding::floor>() << ' ' <<
+    div<dpp::rounding::ceil>() << std::endl;
   std::cout << dpp::div2(1_d32) << std::endl;
   std::cout << dpp::mul2(1_d32) << std::endl;
   std::cout << dpp::div10<1>(1_d32) << std::endl;
 
+  // 25 bps, as a fraction
+  std::cout << dpp::scalb10(25_d32, -4) << ' ' <<
+    dpp::scalb10(1_d64, 40000) << std::endl;
+
+  int n;
+  auto const f(dpp::frexp10(123.45_d64, &n));
+
+  std::cout << f << ' ' << n << ' ' << dpp::ldexp10(f, n) << ' ' <<
+    dpp::ilogb10(123.45_d64) << ' ' << dpp::ndigits(123.45_d64) << std::endl;
+
   return 0;
 }
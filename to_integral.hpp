@@ -7,8 +7,8 @@
 namespace dpp
 {
 
-template <typename U = std::intmax_t, typename T, typename E>
-constexpr auto to_integral(dpp<T, E> const& a) noexcept
+template <typename U = std::intmax_t, typename T, typename E, rounding R>
+constexpr auto to_integral(dpp<T, E, R> const& a) noexcept
 {
   if (isnan(a))
   {
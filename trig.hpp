@@ -0,0 +1,701 @@
+#ifndef DPP_TRIG_HPP
+# define DPP_TRIG_HPP
+# pragma once
+
+#include <utility>
+
+#include "exp.hpp"
+#include "two_pi.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+inline constexpr char const pi2_digits[]{ // pi / 2
+  "1.57079632679489661923132169163975144209858469968755291048747229615390"
+  "8203143104499314017412671058533991074043256641153323546922304775291115"
+  "8626797040642405587251420513509692605527798223114744774651909822144054"
+  "8783296672306423782411689339158263560095457282428346173017430522716332"
+  "410669680363012457063686229350330315779408744076046"
+};
+
+inline constexpr char const* const sin8_digits[]{ // sin(j / 8), j = 1 .. 6
+    "0.12467473338522768995744270871210846758783490564167925788551471462667"
+    "0787392373359748221500096898986765708622832056882151097898112173371315"
+    "0725907709410402342444199350121448183955276591026801773644387737635772"
+    "3000720365468168068290794274935048503016834788084750082551394656511406"
+    "703817866891382219165158280665522719524972944748175",
+    "0.24740395925452292959684870484938919589339098038696581067654483049439"
+    "8136043486821690984848527973792338327197752176516138259577470912266694"
+    "1829453187428446557160438865849319343042719836763616532366713438304970"
+    "5879331361781393041292191254618633494538123666979643692123228426839338"
+    "531837875061740612133809256037320492310294313470080",
+    "0.36627252908604756137290935171626415717641301439735790286853132090670"
+    "5018896841972388096228526381106022732759618556882117469760550281577221"
+    "7549076752923241460976042542148243143628028955363569743936301972396358"
+    "0271097608328351993046691303666035196895295867070409178572509795725538"
+    "980416574858236572601011142350664795987689295992207",
+    "0.47942553860420300027328793521557138808180336794060067518861661312553"
+    "5000287814832209631274684348269086132091084505717417811093748609940282"
+    "7801539620461919246099572939322814005335463381880552285956701356998542"
+    "3363912107172077738015297987137716951517618072114969807370147476869703"
+    "198703900097339549102989443417733111109673903936124",
+    "0.58509727294046215480539931415008044068946234099604521454486340713720"
+    "2926007094619840552687161500509818877732158253667079471169555240774034"
+    "5509533953453845777663097869322659078177568337764612548973328340674691"
+    "1870891369837093305025292695134421743815125608294344426611884918834168"
+    "165609580732381261408968750594782933321421745686480",
+    "0.68163876002333416673324195277989393533838239465922990921362526215110"
+    "0388887003782753145274849781911981438190343146876189498776121741565579"
+    "9380970141880702054704917840293548602257922867899850407618931313620441"
+    "2972600435309261826486390033239965042230188009357096001408841202105927"
+    "536281954251083612941912368593345244247702532215587"
+};
+
+inline constexpr char const* const cos8_digits[]{ // cos(j / 8), j = 1 .. 6
+    "0.99219766722932905314909690778825086954332730473660126346890969719396"
+    "4058840061481721236290935844357281954411269905288441543234245868542225"
+    "4129777695379494845154775916232953344100621440775909734343136066657937"
+    "6557107838783210217842248061202809175083247290939086029914377558422590"
+    "631123467002241214748301926697322618085706193939354",
+    "0.96891242171064478414459544949418919980413419028744283114812812428894"
+    "2561184523327264655202799685025510352709626116202617309464484050149963"
+    "5918317468091384442716367646155366394813979586138930757125858493277526"
+    "6453190907960360412490173617284800733374295167287844553720737272255814"
+    "557029659729813198686772101897175245813609515692945",
+    "0.93050762191231429114947679222955550809519100187151001128940504268137"
+    "7458401395098154150127933027989967902579923507390259863710651580964159"
+    "6776710510261676582481166802090986863080897743230392847767702647889168"
+    "9736883683586896480751483771533833507545205313873104273638370243638377"
+    "902902219937875304636557337392392402319969499855573",
+    "0.87758256189037271611628158260382965199164519710974405299761086831595"
+    "0763274213947405794184084682258355478400593109053993413827976833280266"
+    "7997561209502240155876291568785907234769393109896167396770144089976491"
+    "2857021346821838454381839331616880754066081115940348983190805262434229"
+    "367983882103953443260971069339648047544648581904315",
+    "0.81096311950521790218953480394108073540017615189686957792835956107023"
+    "8521258877461973648162853791853927581489292482892920020507740489568254"
+    "6470878822246935726662516991233787196290605236157344024782992175664017"
+    "7568001095201571334784140025991640014154384771114753758934078466242859"
+    "442305819069931929565448322978840555385926568664503",
+    "0.73168886887382088631183875300008454384054127605077248250768322022075"
+    "0082501569499540967562610201174960122884908227300720779858320608699869"
+    "2704492724359553288886097981267614474861754247197962538548574041892235"
+    "8075918579557240624279998390781750258894604675793363184319604661684417"
+    "542816555386569166986533455750765784290011731734386"
+};
+
+inline constexpr char const* const atan8_digits[]{ // atan(j / 8), j = 1 .. 8
+    "0.12435499454676143503135484916387102557317019176980408991511411911572"
+    "2267427566758623710594313353330326379051303438379043811163083968395046"
+    "7122437868717113885910240125090400271878810265492587698900097326590601"
+    "1694932561477352380174653752050574821602248006715464219160658033901853"
+    "095048722664103400886537294276104206350186542951036",
+    "0.24497866312686415417208248121127581091414409838118406712737591466735"
+    "5119587642096574534157668701991363834804490037118374295485420995059976"
+    "9589869606142037352012770873875816557215867159826385506320522087873067"
+    "5014341562336348263956369780852159107324583523813507629995556890112583"
+    "026626233025991575328102760623356027536107520217857",
+    "0.35877067027057222039592006392646049977697565588091577964039886675470"
+    "3184221129328743264409269425373070784067409590929393345243560747173249"
+    "9075371084244934440334237776862826043732525021829276587879133408039060"
+    "1512564854019952001321580997759606967018608506662547984220868030666618"
+    "280265766563895493753436939682949963534379909638645",
+    "0.46364760900080611621425623146121440202853705428612026381093308872019"
+    "7864165741705300600283984887892556529852251190837513505818181625011155"
+    "4715305699441056207193362661648801015325027559879258055168538891674782"
+    "3728653879391801251719948401395583818511509502163330649387215460973207"
+    "855555720860146322756524267305218045746400869745058",
+    "0.55859931534356243597150821640166127034644758253401480613363603814174"
+    "8236026976576275296187931530067095269075035644031236865562815297647082"
+    "6313006629619134796000916184230290428467590383019240066947973592875225"
+    "8357497387713586493095986620699228400424721789433762775983945962908302"
+    "446839875883189083444649845012535938965291986979277",
+    "0.64350110879328438680280922871732263804151059111531238286560611871351"
+    "2474811621088712816844701282748878014338754259478296535285941525268804"
+    "9196185641760293172864695190212090574877743103356228664314832038794490"
+    "1325988913522821278971792536367095923072438278101684874242999600769916"
+    "699558238642719811550637694739894224286607004585929",
+    "0.71882999962162450541701415152590465395141912001831708554277968286112"
+    "0009103024460275251040550161894241343359554029918647739995426771669446"
+    "1503330175139170475518591803927529015156070004822713051572881195360496"
+    "7577642127862177182349444605107878416501145230744066979180363350126064"
+    "198436995821934856873006825164299110494992137551983",
+    "0.78539816339744830961566084581987572104929234984377645524373614807695"
+    "4101571552249657008706335529266995537021628320576661773461152387645557"
+    "9313398520321202793625710256754846302763899111557372387325954911072027"
+    "4391648336153211891205844669579131780047728641214173086508715261358166"
+    "205334840181506228531843114675165157889704372038023"
+};
+
+template <typename D>
+consteval auto trig_coefficients(std::size_t const o) noexcept
+{ // (-1)^k / (2k + o)!, o = 0: cos, o = 1: sin
+  constexpr auto c(exp_coefficients<D>());
+
+  std::array<D, c.size() / 2> r{};
+
+  for (std::size_t k{}; r.size() != k; ++k)
+    r[k] = k % 2 ? -c[2 * k + o] : c[2 * k + o];
+
+  return r;
+}
+
+template <typename D>
+consteval auto atan_coefficients() noexcept
+{ // (-1)^k / (2k + 1), enough terms for |t| <= 1 / 16
+  constexpr auto N(
+    []() noexcept
+    { // 16^-(2k + 1) < 10^-(digits + 2)
+      long double p(1), t(1. / 16);
+
+      for (auto i(exp_digits<D>().first + 2); i; --i) p /= 10;
+
+      std::size_t n{};
+      for (; t >= p; t /= 256, ++n);
+
+      return n + 1;
+    }()
+  );
+
+  std::array<D, N> c{};
+
+  for (std::size_t k{}; N != k; ++k)
+    c[k] = k % 2 ? -(D(1) / D(2 * k + 1)) : D(1) / D(2 * k + 1);
+
+  return c;
+}
+
+template <typename D, std::size_t N>
+consteval auto to_constants(char const* const (&s)[N]) noexcept
+{
+  std::array<D, N> r{};
+
+  for (std::size_t i{}; N != i; ++i) r[i] = to_constant<D>(s[i]);
+
+  return r;
+}
+
+template <typename D>
+struct reduction
+{ // Payne-Hanek, x * 2 / pi mod 4 in fixed point, with q digits
+  using T = typename D::sig_t;
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  static constexpr F n{maxpow10e<T, F>()}; // digits per chunk
+  static constexpr F q{maxpow10e<U, F>() - 1}; // 8 * 10^q fits
+
+  static constexpr auto p10{
+    []() noexcept
+    {
+      std::array<U, q + 1> p{U(1)};
+
+      for (std::size_t i(1); p.size() != i; ++i) p[i] = U(10) * p[i - 1];
+
+      return p;
+    }()
+  };
+
+  static constexpr auto chunks{
+    []() noexcept
+    { // n digit chunks of the fraction of 2 / pi
+      std::array<T, (sizeof(two_pi_digits) - 3) / n> c{};
+
+      for (std::size_t i{}; c.size() != i; ++i)
+        for (F j{}; n != j; ++j)
+          c[i] = T(10) * c[i] + T(two_pi_digits[2 + i * n + j] - '0');
+
+      return c;
+    }()
+  };
+
+  // the exponent beyond which chunks run out, above every 16 bit exponent;
+  // beyond it, the missing digits count as 0, the results are finite, but
+  // not accurate
+  static constexpr F emax{F(chunks.size()) * n - 2 * q - 2};
+
+  static constexpr std::pair<D, int> reduce(D const& x) noexcept
+  { // x >= 0, x = (k + f) * pi / 2, |f| <= 1 / 2, returns f * pi / 2, k
+    constexpr auto& m4(p10[q]); // 10^q
+    constexpr auto s4(U(4) * m4);
+
+    U const m(x.sig());
+    F const e(x.exp());
+
+    U s{};
+
+    // the place value of chunk j is e - (j + 1) * n; 10^2 = 0 mod 4
+    for (auto j(e > F(1) ? (e - F(2)) / n : F{}); F(chunks.size()) > j; ++j)
+    {
+      auto const P(m * U(chunks[j]));
+
+      if (auto const p(e - (j + F(1)) * n); p >= F{})
+        s += (P % U(4)) * p10[p] % U(4) * m4;
+      else if (-p <= q)
+        s += P % (U(4) * p10[-p]) * p10[q + p];
+      else if (-p - q < F(p10.size()))
+        s += P / p10[-p - q];
+      else
+        break;
+
+      s %= s4;
+    }
+
+    auto const k((s + U(5) * p10[q - 1]) / m4);
+
+    return {
+      D(s - k * m4, -q) * ar::coeff<to_constant<D>(pi2_digits)>(),
+      int(k) & 3
+    };
+  }
+};
+
+template <typename D>
+constexpr auto sincos(D const& r) noexcept
+{ // |r| <= pi / 4
+  constexpr auto cs(ar::coeff<trig_coefficients<D>(1)>());
+  constexpr auto cc(ar::coeff<trig_coefficients<D>(0)>());
+
+  // r = j / 8 + t, |t| <= 1 / 16
+  auto const j(int(round(abs(r) * D(8))));
+  auto const t(abs(r) - D(direct, typename D::sig_t(125 * j), -3));
+  auto const z(t * t);
+
+  auto s(cs.back()), c(cc.back());
+
+  for (auto i(cs.size() - 1); i--;) s = fma(s, z, cs[i]);
+  for (auto i(cc.size() - 1); i--;) c = fma(c, z, cc[i]);
+
+  s *= t;
+
+  if (j)
+  {
+    auto const sj(ar::coeff<to_constants<D>(sin8_digits)>()[j - 1]);
+    auto const cj(ar::coeff<to_constants<D>(cos8_digits)>()[j - 1]);
+
+    std::tie(s, c) = std::pair(fma(sj, c, cj * s), fma(cj, c, -(sj * s)));
+  }
+
+  return std::pair(intt::is_neg(r.sig()) ? -s : s, c);
+}
+
+template <typename D>
+consteval auto fixed_trig_coefficients(int const o) noexcept
+{ // (-1)^k / (2k + o)! in fixed point, o = 0: cos, o = 1: sin(t) / t, enough
+  // terms for |t| <= 1 / 16
+  using B = fixed_t<D>;
+  using U = typename B::U;
+
+  constexpr auto N(
+    []() noexcept
+    { // 16^-2k / (2k)! < 10^-(Q + 1)
+      long double p(1), t(1);
+
+      for (auto i(B::Q + 1); i; --i) p /= 10;
+
+      std::size_t k{};
+      for (; t >= p; ++k, t /= 256 * (2 * k - 1) * (2 * k));
+
+      return k + 1;
+    }()
+  );
+
+  std::array<U, N> c;
+
+  U f(1);
+
+  for (std::size_t k{}; N != k; ++k)
+  {
+    if (k) f *= U(2 * k + o) * U(2 * k + o - 1);
+
+    c[k] = k % 2 ? -(B::p10[B::Q] / f) : B::p10[B::Q] / f;
+  }
+
+  return c;
+}
+
+// sin, cos and tan in fixed point, Q = P + 7 places, rounded once; the
+// argument is reduced with as many digits of 2 / pi as the cancellation
+// takes, r = j / 8 + t, |t| <= 1 / 16
+template <typename D>
+struct itrig_t: fixed_t<D>
+{
+  using B = fixed_t<D>;
+  using typename B::U;
+  using typename B::F;
+
+  using B::Q;
+  using B::W;
+  using B::p10;
+  using B::mul;
+  using B::div;
+
+  static constexpr int P{maxpow10e<typename D::sig_t>() + 1};
+
+  // reduction limbs, m * 10^d * c of P + 2n digits fits
+  using L = typename D::sig2_t;
+
+  // digits per chunk of 2 / pi, a chunk fits the significand type
+  static constexpr int n{std::min((int(maxpow10e<L>()) - P) / 2, P - 1)};
+
+  // fraction limbs; the chunks left out reach P + n - 1 digits into the
+  // last, Q + 1 digits remain below as many as P + 7 zeros, more than the
+  // 7, 16 and 25 zeros at most of d16, d32 and d64
+  static constexpr int K{(Q + 2 * P + n + 7 + n - 1) / n};
+
+  static constexpr auto chunks{
+    []() noexcept
+    { // n digit chunks of the fraction of 2 / pi
+      using T = typename D::sig_t;
+
+      std::array<T, (sizeof(two_pi_digits) - 3) / n> c{};
+
+      for (std::size_t i{}; c.size() != i; ++i)
+        for (int j{}; n != j; ++j)
+          c[i] = T(10) * c[i] + T(two_pi_digits[2 + i * n + j] - '0');
+
+      return c;
+    }()
+  };
+
+  static constexpr U pi2{B::from(pi2_digits)};
+  static constexpr U pi4{pi2 / U(2)};
+
+  static constexpr auto sin8{
+    []() noexcept
+    {
+      std::array<U, std::size(sin8_digits)> r;
+
+      for (std::size_t i{}; r.size() != i; ++i) r[i] = B::from(sin8_digits[i]);
+
+      return r;
+    }()
+  };
+
+  static constexpr auto cos8{
+    []() noexcept
+    {
+      std::array<U, std::size(cos8_digits)> r;
+
+      for (std::size_t i{}; r.size() != i; ++i) r[i] = B::from(cos8_digits[i]);
+
+      return r;
+    }()
+  };
+
+  static constexpr auto cs{fixed_trig_coefficients<D>(1)};
+  static constexpr auto cc{fixed_trig_coefficients<D>(0)};
+
+  template <std::size_t N>
+  static constexpr U series(std::array<U, N> const& c, U const v) noexcept
+  {
+    auto r(c.back());
+
+    for (auto j(N - 1); j--;) r = c[j] + mul(v, r);
+
+    return r;
+  }
+
+  struct arg_t
+  { // |x| = (k + f) * pi / 2, r = f * pi / 2 = g * 10^-G, neg if f < 0
+    U g;
+    F G;
+    int k;
+    bool neg;
+  };
+
+  static constexpr arg_t reduce(U const m, F const e) noexcept
+  { // m > 0, Payne-Hanek, x = m' * 10^(n a), m' = m * 10^d, the limbs l of
+    // m' * 2 / pi mod 4 in base 10^n; 10^2 = 0 mod 4, so chunks at or above
+    // 10^n count for nothing
+    constexpr L b(p10[n]);
+
+    auto const d(((e % F(n)) + F(n)) % F(n));
+    auto const a((e - d) / F(n));
+    auto const mm(L(m * p10[d]));
+
+    std::array<L, K + 1> l{};
+
+    // chunk j is at 10^(n (a - j - 1)), limb i = j - a + 1
+    for (int i{}; K >= i; ++i)
+    {
+      if (auto const j(a - F(1) + F(i)); j < F{}) continue;
+      else if (F(chunks.size()) <= j) break;
+      else
+      {
+        auto const t(mm * L(chunks[j]));
+        auto const h(t / b);
+
+        l[i] += t - h * b;
+        if (i) l[i - 1] += h;
+      }
+    }
+
+    for (int i(K); i; --i)
+    {
+      auto const h(l[i] / b);
+
+      l[i - 1] += h; l[i] -= h * b;
+    }
+
+    int k(l[0] % L(4));
+    bool const neg(L(2) * l[1] >= b);
+
+    if (neg)
+    { // f - 1
+      ++k;
+
+      bool c{};
+
+      for (int i(K); i; --i)
+        if (l[i] || c) l[i] = b - l[i] - L(c), c = true;
+    }
+
+    // the first Q + 1 significant digits of f, the last limb cut in L
+    int i(1);
+
+    for (; (K >= i) && !l[i]; ++i);
+
+    U g(K >= i ? U(l[i]) : U{});
+    F G(n * i);
+
+    for (auto c(Q + 1 - B::digits(g)); g && (c > 0); c -= n)
+      if (auto const t(++i > K ? L{} : l[i]); c >= n)
+        g = g * U(b) + U(t), G += F(n);
+      else
+        g = g * p10[c] + U(t / L(p10[n - c])), G += F(c);
+
+    return {mul(g, pi2), G, k & 3, neg};
+  }
+
+  static constexpr arg_t arg(U const m, F const e) noexcept
+  { // m > 0
+    if (auto const c(Q + 1 - B::digits(m)); B::digits(m) + e <= F{})
+      if (auto const G(F(c) - e);
+        (G > F(Q + 1)) || (m * p10[c] <= U(10) * pi4))
+        return {m * p10[c], G, 0, false};
+
+    return reduce(m, e);
+  }
+
+  template <bool tan = false>
+  static constexpr auto kernel(U const g, F const G) noexcept
+  { // sin(r), cos(r) and, if tan, tan(r), r = g * 10^-G in [0, 0.8); sin and
+    // tan at the places returned, cos at Q places
+    auto const a(G - F(Q) > F(W) ? U{} : g / p10[G - Q]);
+    auto const j(int((U(8) * a + p10[Q] / U(2)) / p10[Q]));
+
+    if (!j)
+    { // sin(r) / r and cos(r) are below 1, tan(r) / r above, if r > 0, even
+      // if the difference is below the digits
+      auto const v(mul(a, a));
+      auto const s(std::min(series(cs, v), p10[Q] - U(1)));
+      auto const c(std::min(series(cc, v), p10[Q] - U(1)));
+
+      U t{};
+
+      if constexpr(tan) t = mul(g, std::max(div(s, c), p10[Q] + U(1)));
+
+      return std::tuple(mul(g, s), c, t, G);
+    }
+    else
+    {
+      auto const t(a - U(125 * j) * p10[Q - 3]);
+      auto const v(mul(t, t));
+      auto const st(mul(t, series(cs, v))), ct(series(cc, v));
+
+      auto const& sj(sin8[j - 1]);
+      auto const& cj(cos8[j - 1]);
+
+      auto const s(mul(sj, ct) + mul(cj, st)), c(mul(cj, ct) - mul(sj, st));
+
+      return std::tuple(s, c, tan ? div(s, c) : U{}, F(Q));
+    }
+  }
+
+  template <typename V>
+  static constexpr V to(U const z, F const G, bool const neg) noexcept
+  {
+    return B::template to<V>(neg ? -z : z, -G, true);
+  }
+
+  template <typename V>
+  static constexpr std::pair<V, V> sincos(U const m, F const e) noexcept
+  { // x = m * 10^e, sin(-x) = -sin(x), cos(-x) = cos(x)
+    if (!m) [[unlikely]] return {V{}, V(1)};
+
+    auto const xneg(intt::is_neg(m));
+    auto const [g, G, k, neg](arg(xneg ? -m : m, e));
+    auto const [s, c, t, Gs](kernel(g, G));
+
+    switch (k)
+    {
+      case 0: return {to<V>(s, Gs, xneg != neg), to<V>(c, F(Q), false)};
+      case 1: return {to<V>(c, F(Q), xneg), to<V>(s, Gs, !neg)};
+      case 2: return {to<V>(s, Gs, xneg == neg), to<V>(c, F(Q), true)};
+      default: return {to<V>(c, F(Q), !xneg), to<V>(s, Gs, neg)};
+    }
+  }
+
+  template <typename V>
+  static constexpr V tan(U const m, F const e) noexcept
+  { // tan(x + pi / 2) = -1 / tan(x)
+    if (!m) [[unlikely]] return {};
+
+    auto const xneg(intt::is_neg(m));
+    auto const [g, G, k, neg](arg(xneg ? -m : m, e));
+    auto const [s, c, t, Gs](kernel<true>(g, G));
+
+    if (k % 2)
+    { // c / s, s normalized to Q + 1 digits
+      auto const d(Q + 1 - B::digits(s));
+      auto const S(d >= 0 ? s * p10[d] : s / p10[-d]);
+
+      return to<V>(div(c, S), F(2 * Q) - Gs - F(d), xneg == neg);
+    }
+    else
+    {
+      return to<V>(t, Gs, xneg != neg);
+    }
+  }
+};
+
+template <typename D>
+inline constexpr bool itrig_v(!intt::is_intt_v<typename D::sig2_t>);
+
+}
+
+//
+template <typename T, typename E, rounding R>
+constexpr std::pair<dpp<T, E, R>, dpp<T, E, R>> sincos(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if (isnan(x)) [[unlikely]] return {nan, nan};
+
+  if constexpr(detail::itrig_v<D>)
+  {
+    using S = detail::itrig_t<dpp<T, E>>;
+
+    return S::template sincos<D>(typename S::U(x.sig()), x.exp());
+  }
+  else
+  {
+    using P = detail::reduction<D>;
+
+    auto const a(abs(x));
+
+    if (a <= ar::coeff<detail::to_constant<D>(detail::pi2_digits) *
+      D(direct, T(5), E(-1))>()) return detail::sincos(x);
+
+    auto const [r, k](P::reduce(a));
+    auto const [s, c](detail::sincos(r));
+
+    auto const neg(intt::is_neg(x.sig()));
+
+    switch (k)
+    {
+      case 0: return {neg ? -s : s, c};
+      case 1: return {neg ? -c : c, -s};
+      case 2: return {neg ? s : -s, -c};
+      default: return {neg ? c : -c, s};
+    }
+  }
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> sin(dpp<T, E, R> const& x) noexcept
+{
+  return sincos(x).first;
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> cos(dpp<T, E, R> const& x) noexcept
+{
+  return sincos(x).second;
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> tan(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  if constexpr(detail::itrig_v<D>)
+  {
+    using S = detail::itrig_t<dpp<T, E>>;
+
+    if (isnan(x)) [[unlikely]] return nan;
+
+    return S::template tan<D>(typename S::U(x.sig()), x.exp());
+  }
+  else
+  {
+    auto const [s, c](sincos(x));
+
+    return s / c;
+  }
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> atan(dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  using namespace detail;
+
+  constexpr auto ca(ar::coeff<atan_coefficients<D>()>());
+
+  if (isnan(x)) [[unlikely]] return nan;
+
+  // atan(a) = pi / 2 - atan(1 / a)
+  auto const inv(abs(x) > D(1));
+  auto const a(inv ? D(1) / abs(x) : abs(x));
+
+  // atan(a) = atan(j / 8) + atan(t), t = (a - j / 8) / (1 + a * j / 8)
+  auto const j(int(round(a * D(8))));
+  D const c(direct, T(125 * j), E(-3));
+
+  auto const t(j ? (a - c) / fma(a, c, D(1)) : a);
+  auto const z(t * t);
+
+  auto r(ca.back());
+
+  for (auto i(ca.size() - 1); i--;) r = fma(r, z, ca[i]);
+
+  r *= t;
+
+  if (j) r += ar::coeff<to_constants<D>(atan8_digits)>()[j - 1];
+  if (inv) r = ar::coeff<to_constant<D>(pi2_digits)>() - r;
+
+  return intt::is_neg(x.sig()) ? -r : r;
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> atan2(dpp<T, E, R> const& y, dpp<T, E, R> const& x) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  constexpr auto pi(numbers::pi_v<D>);
+  constexpr auto pi2(ar::coeff<detail::to_constant<D>(detail::pi2_digits)>());
+
+  if (isnan(y) || isnan(x)) [[unlikely]] return nan;
+  else if (!x.sig())
+    return !y.sig() ? D{} : intt::is_neg(y.sig()) ? -pi2 : pi2;
+  else if (abs(y) > abs(x))
+  { // y / x might overflow
+    auto const r(atan(x / y));
+
+    return intt::is_neg(y.sig()) ? -pi2 - r : pi2 - r;
+  }
+  else if (auto const r(atan(y / x)); intt::is_neg(x.sig()))
+    return intt::is_neg(y.sig()) ? r - pi : r + pi;
+  else
+    return r;
+}
+
+}
+
+#endif // DPP_TRIG_HPP
@@ -0,0 +1,511 @@
+#ifndef DPP_TWO_PI_HPP
+# define DPP_TWO_PI_HPP
+# pragma once
+
+// generated, 2 / pi to 33000 places after the point, truncated, by this
+// Python script (Chudnovsky's series in the decimal module, about a minute),
+// run as "python3 two_pi.py 33000":
+//
+//   import sys
+//   from decimal import Decimal, ROUND_DOWN, getcontext
+//
+//   N = int(sys.argv[1]) if len(sys.argv) > 1 else 33000
+//   getcontext().prec = N + 20
+//
+//   K, M, L, X, S = 6, 1, 13591409, 1, Decimal(13591409)
+//   for i in range(1, N // 14 + 2):
+//       M = M * (K ** 3 - 16 * K) // i ** 3
+//       L += 545140134
+//       X *= -262537412640768000
+//       S += Decimal(M * L) / X
+//       K += 12
+//
+//   pi = 426880 * Decimal(10005).sqrt() / S
+//   print((2 / pi).quantize(Decimal(1).scaleb(-N), rounding=ROUND_DOWN))
+
+namespace dpp
+{
+
+namespace detail
+{
+
+inline constexpr char const two_pi_digits[]{ // 2 / pi, reduction
+  "0.63661977236758134307553505349005744813783858296182579499066937623558"
+  "7190536906140360455211065012343824291370907031832147571647384458314611"
+  "5118696429267993569169598677496363102923109855877012307548695715848695"
+  "9064677344956096689451604732952045689079902286376184756034761069582448"
+  "1957643747751376342114892399785773600994689390957838443593292387132299"
+  "6246679458512187977946087515262991462678569641559834965573944399354723"
+  "9679984977150234068471543372447007506864218619014795203895784145903733"
+  "5072237209977986541221308627102012881299111265588664091786992478392663"
+  "3624240672121439925356479499953311466177411190202800649627102575553982"
+  "8524352048879750459072551105895156253227218583191392704524970925627984"
+  "3100098001191039428356227611187140526100840065270984083699246424962245"
+  "8248125859363569938367657408463016302248034861064272088686365630298983"
+  "3089039098514159950062131756325592708963743301918829331487616279990363"
+  "0630831397388157435931234869370256146758046650182823773310525074600104"
+  "4908718846128450398017546717801505022433452684678103903251289976649333"
+  "7258042449414751425245454676866856827898784051700231334421247843437803"
+  "9358226874839818986041726495262070323357771919883998021017550264517783"
+  "5332273842031411660605641619571954025552643104787972293641559983147675"
+  "6239237495108824750172890875720546502104495512155015552442725627061736"
+  "3313114107733707198224283161544241410955984980503982997105188094376382"
+  "3372046593185647423108496230177978280871590791696379613091790808665984"
+  "1426127261417601536275949887076635505276386602785761910788275073462711"
+  "2419119181801413583033207527354751751064499259812239862320876334395004"
+  "1405085161729263219948787475110378626538488413681776342199140151709547"
+  "7717414647751131714943751373881292094858335169422847454536771784073272"
+  "9167856660035132317325413991163989834597161069802439574756378353220134"
+  "8122152218924928632377279070412913252567592389992897533406974279593900"
+  "0415800273552015914689439843209601095604349981941915169427304455979561"
+  "3075989708333984459683315615107138972142018273824334685917233826893308"
+  "1419415702248083473572963982488470132735760838831742830998619952347442"
+  "6544387464786814989816841132487700738489933996464459826622415187870455"
+  "9725131984310433111960403132144009353091951634160955046229781723704047"
+  "6402173519935561861968499318064282914120209088409440700932526927190372"
+  "4420131262043749565455858122317042872033447181950689858392189590916979"
+  "2436803748503147673331583545135961743474666559026937805638014549308766"
+  "9724555226553229036921103893802421928511121482613511321286839509398662"
+  "7396320130795402696716585873403312646741325734464292398059941247927893"
+  "5033776839366623816609002573577251457761535534246035190865800682588270"
+  "0750982423664348674314317569049390253268445319946237663875628794027549"
+  "7692023007679082276015287357024881354969414502723341662606918843524688"
+  "7183747330259540749998994834212466393224405568578178406459538110810045"
+  "6442809940869589804154669456154914403986995726942472482846961915597475"
+  "5462276923139400922282285762545545280947408042964022994369124462887872"
+  "0159129903812006678340884921385675094601741870585826263887604492339068"
+  "3972388343651345866767671077551657332622660267925286566084035828469144"
+  "9537042827138070404453803202797907368942795849952206310392381358832341"
+  "9002390145062596137577816823271545742732168001260382378973757010179402"
+  "6996571634590057692132853298278046539782710157576961443621753342113169"
+  "7368813979374646058652914409910666641981256262937430212056363311952365"
+  "9146773739690950410539991319828072647857284932561903051589936331564696"
+  "3899130551596726799757949990860795927490665178407322158333100836945402"
+  "7415556913872989039890113203067427750334638891679297718989624655273245"
+  "5833226977394067714389532949570649609738007991239761608758453933709445"
+  "4705799655308616664253699317454967402449044344528479945338513883976735"
+  "9770971823662513335961921528470004644846668820765031721421171696453761"
+  "2464536449981273543707833961775387231396389593123542118818061221596560"
+  "3954795363534619346608898674496349016056160364714968488180923013389589"
+  "0152597615536762347369246378529097735626450064957242513278129553356852"
+  "6138225526047008140434983823280449501743907262136074962957736145359121"
+  "5526884018126767318077951836706958167115169741104696289842375664109291"
+  "3151787277459651579885981373021089436663719228991994322450760293287537"
+  "8107177340182320780997026522481950646453746135968115018083422137657639"
+  "6205193090981863647252889313620466646260283935022973491819452481644868"
+  "6552366242464466292800033322445842472512130503478380640985286645543064"
+  "5921887973083108526576480637984044253132208303833394012203163823399319"
+  "2874696115935420553295828083230559020171690393905882840657078975380172"
+  "3666345811344129973441741862895023166454652964818312398788626536088635"
+  "2218317725313112022098452835560749684843697956416402086198723884548830"
+  "1602284385362657254298175966390777431556831737024711320889480459456997"
+  "0095699491485252808706694430265823930904382966264093751497451652843899"
+  "4358860285229564162905741656718822889061919215260510383164960101378721"
+  "9288104693691960040819322498521351858987127620072473215006152115180937"
+  "3367820085427590836516224572715151683448229799970315902760739684129682"
+  "5885540764555259025608390422195831751405656165812206063358571293061624"
+  "0824132475663462810883450010796655750061115494424324582277936841289631"
+  "0909096866054569374679708653612376212299226107403720663568547685657251"
+  "7485364246286148562481591390473706011912314425067879843236736893905340"
+  "1909868760698018057846655313848329634694380409485211617775117634140137"
+  "8177053365225052298380553212409172587737867331407065312966060840717690"
+  "5775828724868680870259687857797586128888750633952978047637605362017728"
+  "5594345144843327175758433775592076591495590893241145240525947820850482"
+  "0731122539782847465111302639532402140620926663937576360887225257818084"
+  "8519158937885954965033072895440944108439924766082275293889593432053464"
+  "2735145315471714478929469014426740867425280477959122935833676762663833"
+  "5471411764967487286911950024415784259278342982480243568491366557749538"
+  "6198359728113924945733864478829297238183436293447514516252740066042507"
+  "0307404865430354785229807996880043106707323787925990249072973917468524"
+  "3364840878083597927649776195004684236737655963155782310073848647616612"
+  "3738175211235754512292950314461071188457329296787943122255052072353754"
+  "6562428701473285450518684897043771416044385287305106048046809021171715"
+  "8622378432819753636276304276801581858476656008626934407163852749156799"
+  "4537364347612802318654841251444942795527056145701016334839243259340761"
+  "2485274498891272420338049476076258652894375548981852294909123515932016"
+  "4075794365469497035767249622691676495201322537999287852632154552421698"
+  "3157380033821312125404753736402949224238261774944995508517051592296941"
+  "5629624714762313777242109705056707132023288594584915744771867719681321"
+  "8677331375263221425945629273776239819875741509273469064525204344943520"
+  "8515217315737824856191915781693494423402530817599277305436667493677746"
+  "2713560512764881126491800133204894436743502368078363248966147179963817"
+  "9552439903567956324632465415556653576116948881993935008969448364033363"
+  "9026716684033667182808932715884284117155395880523981359816976613402425"
+  "0337568580973545856137297626292699102136216179240247104502763389858457"
+  "3190617560003353060845808406494657244791949276110047657648544678481827"
+  "7441053444094238485618681160486271856749429873434926893240189838533590"
+  "9299081796755405376614550403661502570697538006648855748772269948251526"
+  "3818592791007688308409469731562507628364716776511048489804689418708462"
+  "5617334308824666462586978985092224916533281238133622055366872778421286"
+  "0057053120035182072531870198913868075346297013700067976924276625372426"
+  "5041736488208553263518844603018162531626280993954594789611488149039477"
+  "1245974425096153693314997693287143151002942287428175149518773609347611"
+  "6457878457945990788777381098697718412357748770162106635562842648250302"
+  "0397215199066334717444512549804419886024615134974318223471888517435057"
+  "8523750288128852809842262644519885241103476451384173007373730766211713"
+  "8342939838860170261597208448739788928529522066199211639678707260472089"
+  "9327700509488799168537324270568749937704863940486705587117411931940783"
+  "4181568427831522347412493110181732916647956212756214901566328891693038"
+  "9112533711273024259529335042878724057925812793344951643068502007011530"
+  "5407345968414290349641426295578779501778776072703692243748331258600742"
+  "9701299876851058496991328843061895002272795338256414183210904500914201"
+  "2617300158367395675930521995036461625284141705556005134970462075150927"
+  "3503449420701514027826398280112046336503548060012068103666985208336964"
+  "9796513569522103090058948564924092069025587322221433305136153455263074"
+  "7313857321827223976074800428780837188071196233286567031947246634618859"
+  "0995858866191795324856172734431937725622292471739871105495959572091106"
+  "2428234121633499101056378974028158085809880673553628363482458877774890"
+  "2601129258349198347895326758850740775616918844288540302791214905018325"
+  "6438015308155594945806513928072187315282331654135605534259657720160628"
+  "2603955170686166980282674755513375222233400478698344936322381308989113"
+  "7531703758308633614754376395975702096675351517429118718066163066957081"
+  "2502567504384876097218797394395679624005191098768581318816867112690460"
+  "7140261203421023999176083987782172618109834268176147467217145936180515"
+  "2472923917398785088734597174206481194898783331979277319133432138360929"
+  "0821045016845774833743833977735345535532710073646435268450051169334983"
+  "0887735928327602162531717511012276264296612199907305884976310752689946"
+  "9368674352603965336883037237886954206373632358284976425388835727796515"
+  "2313430524633176021988356720934663843082837103960421081126034755913141"
+  "9773614905709170484139480559714754142002482460573723146615843439800234"
+  "8597565666082612082803410624962988146429464213352210550670288075357989"
+  "1081888886145354045419338544984794217039754877334699281688389799826690"
+  "8100217856929758300274783653207749876765719239973696922200690660848369"
+  "6582385038422177103638079872972523371187748452828084199292952782988703"
+  "9420780074585237611903774527778003676602464196915057292768518813784374"
+  "3370370691055472574532394274131144097328564209323042635365983434872788"
+  "2849719838369071246911857755415187052557097256911812458000259688506000"
+  "5330744920862033492007027551117621175688756117696575567443610092080500"
+  "2883276580542370097927034967661211416841307550228788999018556528536666"
+  "0052035993943201995273815884902511454969650415361050771220544656533196"
+  "4779291626846027066008687936247924261008535515665048598969499388045208"
+  "7479623823289205621780790768740163524394677988916883536217295463657763"
+  "1045437433590817264812079393475032313430571998953929224105639013556440"
+  "6151401155400835501808929264033882353874245753148221706313122355335985"
+  "3018539965090968058815532253963268565381763571647401154963972798091036"
+  "2185816867694342414582051634574502732014885795832985385204364508774312"
+  "1689232813470295288808695852149537721429274988202839451787256744531645"
+  "2174115628978747589313716691232769323464700385675540094066646164993446"
+  "7003768554612811183494353630487386009900885686402537249854433294738465"
+  "7635117380604187024443354697071607214279499773881454004082343444325516"
+  "3333120018039190461216165001179452724686992713534112022335959996177813"
+  "4249004875112842942456478942194003231213489039571864483013834675677754"
+  "8106714805152943534646528826174669616111065418470080137138574918468258"
+  "4240436258607961233126092807158134710539977025938518684198130668954156"
+  "1881974862183990889297743918681930899588471014630516198349312905591967"
+  "4432760742047740643829536982984773524075458161593365773746135177861051"
+  "6914801933455505221058973697370539706117579757506062344960239596488643"
+  "3801695036212284569860041062119712397805994433353428625984341249665694"
+  "0977745675357885895777986332228228136507254713234466114042476855571656"
+  "1927181973296118425632580204122418952909178669890043658837554108607588"
+  "1804361584027924439796224655271794428703370009645013723095522429851177"
+  "0841810339441529245672254464578682371145692090687512637680413549248946"
+  "5265668462621295370240648002227599623394005184586096152868725416177597"
+  "5906982080858932880513558917873555596402076516672581817601120867152882"
+  "8320021518577124584305747247049010634788476337968929703870918128699778"
+  "5322765658653427861848405665514771839175234199398531525033289664524996"
+  "3310605607928891961058758415893582828324847611474530454803855587374595"
+  "6311825253707681472798270385714305939547861495252482189523763032243164"
+  "4575873431939155582968080415772905789037316262008077538283572575871047"
+  "9767692115627065522848711887878760794623633956606552529749548894629886"
+  "3602336354463921428794207256840327250836384287873307085520790045884577"
+  "8632996771337257562261859691197206090717702606021581768027588100932956"
+  "8729016815553137886377473849641820730887333722223779326419096905549554"
+  "4190366531856107946574182443531707062343883826413515586327966991124675"
+  "4196536341316012246154175875597428675951543015362005964095021669432974"
+  "9815051771501930684149187817309759116956912184713099941989547340165396"
+  "5832627619929323497540878656899839390863259260250827813500283191904089"
+  "4902776067658454994403828476898769145325127307486406381232894069925498"
+  "1963923660916258358250808770610728629256144180739006648051750596208033"
+  "2421891868577485859152007553971069190928941221380382000397970272911356"
+  "4722899805362477250213246054795970216301395234328977762157119573169955"
+  "0808854871621001100503241301151080860906829236497330671684044167352600"
+  "6958752165093534701736167011841943040160068822098197709928876937336983"
+  "2549747420114194733783791593054898970535380378387800026228757719018036"
+  "7085378078752056503535593470236208495669985145417196263130971620733560"
+  "5539627883011292568465490581618345782539931831129507406414330825278236"
+  "1218395395155733420895990455950467026066771752779767588088164162210726"
+  "9023246894183609461385561639620410331499593164189441549204056305171010"
+  "7459410953702639543681008915158451899059751939180513661785369984608062"
+  "4983364628951497203294072606050219343783104513384733384898339297015958"
+  "4148823687282944186903381372939321209777169065420722370854363170583350"
+  "0260946440634821017681817710089598623675322394943201053938477434974333"
+  "0241578230812386619504335553575374930423754110641615650951576473828018"
+  "7286033579351167433937701146342915016523263498785077785656793159143317"
+  "8716041340151060597161887963128912349938153853343976559503927742542381"
+  "7043796800869211288771652984430201366388953191393869421092668779972950"
+  "9818440648861948266911861742755633100300154077745978584494568604894967"
+  "2957084304392473324661183810635429099947933397672696357852516656281882"
+  "1929584799871935154734981587190028907441031297334661455041946950845264"
+  "7915664895728546733407445021699207109186815401315844024299806047027413"
+  "5333168404811645054993939053825149647312528693372223377646243942665248"
+  "6270013052171490493608609951138559766968128527466029214792286899939941"
+  "2272559239482927763614338295925813615865549349992281576971190245439421"
+  "6824722323539701479465210761789563353397825338706875893335699594495327"
+  "5712208723651407497346701160698162170104003732816446246894694723531384"
+  "3058998760715183971082528076913633768791483578119216783618766647670548"
+  "7346349864773861334390009958919136090785814744438461723205763509879502"
+  "4669111731500770067185547947516004212195990166110477135615378823650020"
+  "1007088607672785054241964526148532156124617708524937003953495705491126"
+  "0029199121825988006208277144481710683254930512349625184319250829016327"
+  "5063298560358101187519613373916036368121441747273242217407032999107011"
+  "3721524688556596088627614180601284296698398813303035534409098601172127"
+  "8969994642406492902279268362356547496783045376963909710696559463561920"
+  "0232384660938690029120403592440362632223130013955894792185468730067582"
+  "6103379570948053653592817645547445827491154889961596917881042341737504"
+  "9949909369116446758369679043572772900459560707786540265204667535182926"
+  "3826693220030739887622698836216518297720437459975016334226831582813511"
+  "1348128429792950149731479666717272124108964197310435032798707012541098"
+  "1458143202885468269462797645028850808908168278268905360833184047918261"
+  "4384635377120115308315939981531202158396796699762772149741618100939014"
+  "1143934085708188558670782402855129747056419042008069632758569115182821"
+  "5250318549506166524190555920762407434975471435248358613514076584722028"
+  "0904751210544174740771778096646746117687964678115037077612348242415451"
+  "5733542000222049098292210671016194204989483168509259692874510670964520"
+  "0388198135363196119504879194103193473508380138545785793557637843800625"
+  "5793089367314213677640993564991073474457850759820691040688422523708986"
+  "1309837837553780683859762094067456508811510102014162886196279345579756"
+  "9805994742891758422897584433857634216634237420139853854724495631406157"
+  "4090708403636124755182564229395937350855431409394056885963354105441416"
+  "7641065467089682390564220719052242902171120258885486938720859746407340"
+  "6320038188875560977584259537820782905278988857273127905550703631133714"
+  "4187748872235291962992853836055718929832286318039832543919096996199746"
+  "8318211003323493378178629213889360758539847284901409007482862867652038"
+  "1852927662728282171000455510687019722129805955175676252574162428947184"
+  "2525483395946394410659853806485611884009920880713121608574009152060162"
+  "4148369659491986940430964156582235694606356845450385179517431428363180"
+  "0031005009385060959248416881728339918948798858752181805087942665072110"
+  "2161085569677581110834576299447889344336691460670048733523131523510411"
+  "5916476760114536358295405653025771874473541932330181813082194256016009"
+  "4593556511202741930743982082870864674798611411844125490065923302304927"
+  "8045628975992702413794929874390371021817025337790243249747530704163960"
+  "6155223345659656065258345575920978808456889750876554852269449725370452"
+  "7592561088593891526973257045386062261764683054795475428472809765091742"
+  "2170916408210683140178678307298535357257360003264963311474003163838988"
+  "1981857476535346085844459593537847587503995264667319582272664815493444"
+  "1628250737064878866984494147042480724464458204265840218288635906758629"
+  "0294800388881962889900698801499223105912200566475029651366620378006900"
+  "2701171561916684027846109127157792222505065171710140435628242398866663"
+  "0618078705092713145901356698891674030553849121124218547329536759921937"
+  "2966433699199130342140393775252180822994624534591601826716961819647642"
+  "5382389491646375141626935567325262227003601778977362150731103614387341"
+  "6182890883363933163176297705921695409133363213335402111391456257407738"
+  "5403776513834496551364574257380814719766486054187267889995497358125166"
+  "1790119229000063892351931579619354444850578419261119032904822599861283"
+  "5672150053606811292448242276956477701524623626411742998466181542369611"
+  "6119460335917992261848353739352017646162192605177994438652431561639211"
+  "3609629291973256697281153391529722968880500770606171371861726872393967"
+  "0043013968412864918238186984756937795690831600547822489586254937798897"
+  "1603784406254137461477372898024600730115495253833205006370729685400766"
+  "8497152039258329326839975264495625097666038585390655966667538103399313"
+  "1131732803324852906856878504174034249798000286932705376085058099548092"
+  "2237439636733126137065756405285974303477848407393742782714352626657677"
+  "4113813881125098016373498742557224959663880774103873540192043897799245"
+  "1568118884184988491435407067141777873658761799709714029091704677843249"
+  "0524173983987221786912779750923305151886617784012814940497814954225664"
+  "7822679853770212971517863541370275501720693656386564377739268366894804"
+  "7341781799754803641816785843480826712896242187423214947239885986660346"
+  "8844558622732734802144698121750982107052137283026117203133449499035525"
+  "6423906155150534227863130324080194274267027936045982077869733792179369"
+  "8417305218454682510254349229326916689448507954415643598661654731275947"
+  "8237978289058106072051137687421246414849860011977076062857508083966632"
+  "4863061375697015007435821894101124532878164238542364157905023429727483"
+  "5707037784625063420726932972327509640219378863554606973376917798017394"
+  "9499443504627970481166282900309609838091210713998885296662044448899318"
+  "0670003259443160998670476171129617067771684834839768418821352630607718"
+  "5862598168273997031401414221048499923253030122878451726283289296216758"
+  "3983118542640157793834633062772821249548603934788958786680749784461920"
+  "6724381162039865913796203816723994549128940955740559419628218959685507"
+  "5430122522204192543699351397367804649996065119031025776566779564865828"
+  "0989873237578898902332731940453446818208841937532598690430913221843846"
+  "5487492596800289472306150738140620178959547319524733500205840097929056"
+  "2991878771803562291197834209206993789418908389466699338825443521418232"
+  "2239006390347269258052388967043142888668179498428598130721930175652032"
+  "0536921940209798011485916902351482831942272988076228289726136962034592"
+  "5843452612879448673187502315047284695532605336306144320638871206882556"
+  "2701503792145716641902532702416970206297345330680669017192844002910704"
+  "5394764901265405378296231876012890189734497749436030794257273847854215"
+  "5176242509388147006623895750809839407918482600845317754733614525021523"
+  "3060089101718167954512187800201094207925236200948751621582562753426868"
+  "1924468685588727292317608889179872816838812681227098687673098157216899"
+  "4927808896873738693338725712853424023030269299970930681340806248589215"
+  "8487387082682404781996148114263404646768965166132696517254600898785815"
+  "4333190138570071855795236641385496952671017306437260415494384038572320"
+  "1885215922664247245237286936913894993221489586987620312486764771793146"
+  "8310013307030624955110484276918367279708556560654620349772366605723848"
+  "6441753992492913667159006787104069734997362174804815376573385164787219"
+  "4209621016841237891976271008576820794247172573700157110541794250064041"
+  "1454829025406788537572926616804713738646970055421714703693663489264940"
+  "7655891973893840091236743728556354115194807904916242849944987816092651"
+  "3382511484422315809327220627072032442884827103885303448510470950648890"
+  "5971609782235331625799919696897985943408162453347558370215050349289084"
+  "8361951455316358567282017948233232250110627605070988219492154416904113"
+  "5920939705352928392305706657167782726311755942884424317561240859112538"
+  "0419539060091218611399860523201195214898208018490596647610767158843263"
+  "5750356059277689012186605546276173391901532296215483497833899389668092"
+  "2713182098962946786805434327403135649841629755215404985259248627702063"
+  "9939409413169706616105795495249895486948492839448229781985170954139720"
+  "9422401596376651134419624836950005478942071103947260311944011054660056"
+  "8056276507247199188214621484821918996658837088318169039538238617308792"
+  "8654397127357310123222037112989470885021840754748788665850809918748794"
+  "6446542503050515934368645022552573384841276631675271958112556449812837"
+  "0610697164856424216769204031438849422488335256122749748625424966521713"
+  "5634823288392411766029444834234510094825255963265915970693491536999945"
+  "8952383670069816678561906583499402502614415497335971989290786679279195"
+  "0097709717234566554681960242055362455383163542097643681577643450825152"
+  "5450363463037054774332902357758923975041959012573947530398661707932129"
+  "7255673828670642844655611670655014512149491447543916230604900106801693"
+  "2381053766667837263390442737708831277221283990208419709648599076761039"
+  "8265492857856637957368280993519832265944340534930779612124377801425678"
+  "2545975511446305484379432384164889454835907048047643752804404950607237"
+  "8541280063619677618499929448407257666567087141368327740500267318926519"
+  "6786340847861100190319285896945300537095619488924351575951211451983982"
+  "6234845440971172494422474557731161708656976887731671284087751175397880"
+  "2301754699817267065392823966150316070659749758647407853198262228783643"
+  "0262975694811357558105518801567564752579697293833544518668353218194035"
+  "4361640601786357750255692212548166168510212699942118139154312872839520"
+  "8869354244684611547886703999099302349394745268756408976463446411553994"
+  "4146212630371346435386609687689656275295722062395107283010910386713559"
+  "5251741599372899984164991131594639467703918593323719547789567742830447"
+  "2597448355087633583446477129993887703592612747179238142568908519254438"
+  "4960129118381142935694720732073184912025208585792492485938262407839363"
+  "2954819097097341161645964689956468798934466602728559769168579229820999"
+  "9695374530420900451109641756290675448314885850205937052929881904932300"
+  "9668392434284564296770457426302367641730829172517133780943429284639849"
+  "6332649506557588153393326648992044379026959585426938414317502139550944"
+  "9154069523721832084154800394549689590054837619778557771800365019542456"
+  "6169379591006163928902627486018086493944167856842684461829105784643720"
+  "4135036505620608025955547072357680122459163847207793076034698915949079"
+  "1254513864216741466790741639878191417314976751766893982417491359377502"
+  "3511895231808788682350238110399614768766885627562132635544767011174513"
+  "8348609471664951992150687081918102004980629876600685694817969053119089"
+  "7095477334882357517966682297022072724734102050713462996944419218311506"
+  "4462904964076436004408456955950394759560696914766794895076989350516032"
+  "7172353362896227168695697753847064779747224180966180067314646182409326"
+  "9309421010670753520273288225659146851219579900459187993491469563381511"
+  "6745915316529715662528316479934826667109726249787988725649445823159660"
+  "8677113552654113523907364461492462805890236758308425446459254786924208"
+  "7255235342143497393474893556886412138669588909489675790094478557121127"
+  "5777829719066902345935326924337275219392594187699603531300762236574164"
+  "4351898993776899248814544215743048645311616046111589622039226913364520"
+  "0014536535744242919672944659134076394520721023552619543190507092304050"
+  "9191489130454028527736453641024317221038063093896985534448949398115250"
+  "2193005230956388152580782370379417719177883806568472281990970431735758"
+  "2091227183016796540810835963726670891094868073610167665621942431487735"
+  "1287628245981127415897177588419671723257443921234426318854781759712822"
+  "0327942417486460951429645308257335040920075030714135223973889975355343"
+  "5633568331881079200648281880547190760036617943058479925131670032684917"
+  "3581495197673580499413636207511434409442404271192229515785857595106260"
+  "4473363828750437730988320273834640518723494392751667435316162801963382"
+  "9018012509128653811680677742632032910412190121511408614048314026073102"
+  "8319493749450646000207391256514907945033110237765247525489810037258837"
+  "7876909560645590381272776202234026585040269288748912968373949033129009"
+  "7856468580069357299932871319595065882703815492443700364596833059061939"
+  "1267084945682741307050285843639807094728848883053340595677704294479064"
+  "5995403718998898819160708676846935469423452269766640106308390909770336"
+  "3079743385875474494881565498519563192328298224938156608955778609026993"
+  "0895812595532257729979519254656213846762746237672593747443916879891987"
+  "3249428465572127057174067937546451825649882017601144797302201565313652"
+  "1950978637379172628069331822142534929244313846830183315895114468463997"
+  "0873922587117163741198259373527302580549683385796046465637141614923063"
+  "9847399933740700208899890762046595395002913772747006372556696922592055"
+  "2434895427344226155808590389238720484780752982906982208039335455130039"
+  "9351431218023199209633737674570385739203555528448610889780739033001672"
+  "1970099755019253677746224235754291219724645055462071171726851710379463"
+  "3481580059350373325281175610552168534955437435952762559397490795215270"
+  "8695843116748173419682045223804435660510664763042685922034461683285996"
+  "5230536403858423058059870085219930329437508770948362584120813592414188"
+  "9377171469439580305744727768020591660139813109186986360092226568113776"
+  "7538528515117259212680143150786439793061873623310622597230787543718845"
+  "3650448701473673806470537034928404831249413849165951077300145717062591"
+  "3071536505182356212439725740887211888108509227037049391398840857576793"
+  "1595839059156673492965759170681483471353116649254002775155895683488260"
+  "2374476439857821907990344926218108820725538658632406665883418624797132"
+  "4416709916180158321615680450847562026172788232991602315722705717540196"
+  "1868821852060058833279713589636065522438223456860251481052923664966446"
+  "2313971025016830411438246909009347617639655529226044363901256114997642"
+  "2294642079596174976029776307422161642635705897415234673458001022526726"
+  "3931309664459714428891038276868367037467239169586030307379983503476206"
+  "7592337629042021419283562179176266257589291972768097317450161368578249"
+  "2642859139411533208313406510083652511171638475322272681185905726887817"
+  "4919537719999735433428956007051085493528158629101840266113095937776343"
+  "7364594826700898143563191663659977134778602844371466307585298892051841"
+  "5062880566357431644327836115569365344212702270110724745380144303241854"
+  "2840440710349910368873913409956555097523210853667838481080418654167845"
+  "2245644415869035180064040808139254999561516068513186205408696753342716"
+  "3039385137236516338375972014721183319487173471330249137946908860801051"
+  "9586711362815450702151008384499000511167226625962343820737314496018877"
+  "5521297783660324474943565200652743333412552224850997528553606756874852"
+  "6104087957005666217535798825489900409695387130246960030059261067905871"
+  "5674612368831847464370259113135669336998625593939400755638644456461250"
+  "9089584186415492992519243602981699948978285985723648601707569433477683"
+  "1117034411748880782073049250373415353171856477037095768418835462177023"
+  "7675462475855532566530051119211723265015491884542610835001192515711671"
+  "8685522486031816568233662032661448508912418231534004395195507804136556"
+  "1766357888942259921168573878304791000917057702620898598786832383358878"
+  "5622726552972110824940684884762599649073909431548251276042393076898368"
+  "6349168264558039270956837784267024316252507044409783854615934496573369"
+  "8156377417857342125814195468829565951387567125474592216197572110765119"
+  "7099574781194299231815738383429367346580022805567349310061314474249076"
+  "2373292561643812683034608689970520959166910265745647814205261672682206"
+  "5775478683782598148667573501547960750709272088028688321531440808720261"
+  "7436105896927507940330717648926741517378115563763145043175458045658928"
+  "5158295621374206324019838628019648005554817654527884229612206932766359"
+  "4547142185443320146403021656376407330505318683271892382943342535502924"
+  "0673740247036883433025022711636736767853134496910066754702786840390268"
+  "6073492352732877858988568163879057806216572751690305815608472033887224"
+  "9690979805689748198687736040182999720089530000913603580471526914928172"
+  "8368121616793729815067803436662426170001199159882926565020778109325758"
+  "4956748735563542860815459182225707621921944956672686931899168693629137"
+  "4975520337905873434646467462342838167877061172440022675147850711320333"
+  "7328004740152414676641327328919068372155423198263633135095298940710305"
+  "7712820363411349082914990873726213114763581015007267582553823043105969"
+  "3046415905390011626489334817733474456171917397153469116342580783627505"
+  "9705850798383952449147849465793768590721900024524260998485328686769347"
+  "0217729093206305781121383631697055232251588742737506567541356516184691"
+  "7741128835636258213585715284086745791450370426428269240262332818178567"
+  "6366736707125977422808813006387528253295848347191051679691301148175404"
+  "7968365696910168152589126301491197191726337362387767311197701296863441"
+  "6656643852651350182194524484032549943556307274866956804938784249198086"
+  "4903611373076025269694106223675399253272001259001003170279737974418582"
+  "2794776297990648961617881601834560561813477020931774877679558060532924"
+  "2995455704169660474107813704921508803547207360804502598517008016136694"
+  "0124487572310665650959920631936380450956329587133509097277096329079213"
+  "1178436765120753495044821619084712494863908628569181411982472602984692"
+  "7726911274711667292972316505628167090565627108753730439719568566042289"
+  "6310866797986597263333790233442525351385079847356457537201462034273136"
+  "7739899256834740038162531212938022756374470790232185028784905349124007"
+  "2268807169662880431889698071115742888168488270143028023056421971597001"
+  "9003201247372626728325094391931405546980340013701568012223041677498651"
+  "3753852154842611440783488891080560671779385739143521646690002211441972"
+  "5575689184660014532178160679471661247655608339089803692943243542586514"
+  "1964456037848075481859343327993063742663071487181541500963497699271427"
+  "4891676961750384313457731540482680860284890638409236300145855586056265"
+  "2514274943411361002575229660667976575552145070977838011940551108646622"
+  "6986702844566550518091632451874854874240060217098069312721226864021961"
+  "5948245449656867880940573099645985718708954291861781754160009344933873"
+  "2274625946075883752767561837579533299747224443421271268288947360039036"
+  "4735809279753286850480852676587280800846108819270003304086111728195985"
+  "6299214134272318576707340858059543449779674875397174005416365197065729"
+  "9163307627783237890313292628384867115060802893451566202753112741012856"
+  "1548816168812382561980427889228882299753373773893824519670680405844560"
+  "4096564009793911166141373579389406843209621757705014491473564866450013"
+  "9918640234790749484865980146524113886964921553511633066828788075749078"
+  "7896594276886103471927380518783954587192570567373306346990580318867646"
+  "1825870796465524568687834788329103406553503523143430469813490910634507"
+  "0951659934043913440079977160576436157093074322496582128401924657200361"
+  "1994851193791337983968428023570004019198147502448502869512486055870800"
+  "5335183784456701266829708970896882036623881696743369830111340912309023"
+  "0790956365137759678614081819536730570128152158116564926857628736386231"
+  "1218373997810264492744478503277567504665196623100373730038743273971743"
+  "9072108954390572430134060113795888882300346644603208730615311264101550"
+  "0659937136600292431353187716323848648569605289090108011253583418907743"
+  "7722071474634251121278081513857621438512553258178872146429208882143422"
+  "1198176531392764516228891201104649771774776624259954084904002935137229"
+  "72510377725699688406806267415923"
+};
+
+}
+
+}
+
+#endif // DPP_TWO_PI_HPP
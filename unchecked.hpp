@@ -0,0 +1,132 @@
+#ifndef DPP_UNCHECKED_HPP
+# define DPP_UNCHECKED_HPP
+# pragma once
+
+#include "dpp.hpp"
+
+namespace dpp
+{
+
+namespace detail
+{
+
+template <typename D>
+constexpr D unchecked_make(typename D::sig2_t m, typename D::exp2_t e,
+  bool& s) noexcept
+{
+  using T = typename D::sig_t;
+  using E = typename D::exp_t;
+  using F = typename D::exp2_t;
+
+  D::normalize(m, e);
+
+  // branchless, the flag is sticky
+  s |= bool(m) & ((e <= ar::coeff<F(D::emin)>()) |
+    (e > ar::coeff<F(D::emax)>()));
+
+  return {direct, T(m), m ? E(e) : E{}};
+}
+
+}
+
+// for hot loops over values known to be finite: nan inputs are not checked
+// for and results are not range checked, rounding is unchanged; s is set, if
+// a result over- or underflowed or a division by 0 was attempted, the value
+// of such a result is unspecified
+namespace unchecked
+{
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> add(dpp<T, E, R> const& a, dpp<T, E, R> const& b,
+  bool& s) noexcept
+{
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  U ma(a.m_), mb(b.m_);
+  F ea(a.e_), eb(b.e_);
+
+  return a.e_ < b.e_ ?
+    (detail::align<T, R>(mb, eb, ma, eb - ea),
+    detail::unchecked_make<dpp<T, E, R>>(ma + mb, eb, s)) :
+    (detail::align<T, R>(ma, ea, mb, ea - eb),
+    detail::unchecked_make<dpp<T, E, R>>(ma + mb, ea, s));
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> sub(dpp<T, E, R> const& a, dpp<T, E, R> const& b,
+  bool& s) noexcept
+{
+  return add(a, dpp<T, E, R>(direct, -b.m_, b.e_), s);
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> mul(dpp<T, E, R> const& a, dpp<T, E, R> const& b,
+  bool& s) noexcept
+{
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  return detail::unchecked_make<dpp<T, E, R>>(U(a.m_) * U(b.m_),
+    F(a.e_) + F(b.e_), s);
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> div(dpp<T, E, R> const& a, dpp<T, E, R> const& b,
+  bool& s) noexcept
+{
+  using D = dpp<T, E, R>;
+
+  // an integer division by 0 would trap
+  if (!b.m_) [[unlikely]] { s = true; return {}; }
+  else if (!a.m_) [[unlikely]] return {};
+
+  typename D::exp2_t e;
+  auto const m(D::quotient(a, b, e));
+
+  return detail::unchecked_make<D>(m, e, s);
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> fma(dpp<T, E, R> const& a, dpp<T, E, R> const& b,
+  dpp<T, E, R> const& c, bool& s) noexcept
+{
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  U ma(U(a.m_) * U(b.m_)), mb(c.m_);
+  F ea(F(a.e_) + F(b.e_)), eb(c.e_);
+
+  return ea < eb ?
+    (detail::align<T, R>(mb <<= 1, eb, ma, eb - ea),
+    detail::unchecked_make<dpp<T, E, R>>(ma + (mb >> 1), eb, s)) :
+    (detail::align<T, R>(ma, ea, mb, ea - eb),
+    detail::unchecked_make<dpp<T, E, R>>(ma + mb, ea, s));
+}
+
+// without the flag
+#define DPP_UNCHECKED__(F)\
+template <typename T, typename E, rounding R>\
+constexpr dpp<T, E, R> F(dpp<T, E, R> const& a,\
+  dpp<T, E, R> const& b) noexcept\
+{\
+  bool s{}; return F(a, b, s);\
+}
+
+DPP_UNCHECKED__(add)
+DPP_UNCHECKED__(sub)
+DPP_UNCHECKED__(mul)
+DPP_UNCHECKED__(div)
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> fma(dpp<T, E, R> const& a, dpp<T, E, R> const& b,
+  dpp<T, E, R> const& c) noexcept
+{
+  bool s{}; return fma(a, b, c, s);
+}
+
+}
+
+}
+
+#endif // DPP_UNCHECKED_HPP
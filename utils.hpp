@@ -2,69 +2,256 @@
 # define DPP_UTILS_HPP
 # pragma once
 
+#include <algorithm>
+#include <array>
+#include <utility>
+
 #include "dpp.hpp"
 
 namespace dpp
 {
 
+namespace detail
+{
+
+template <auto B>
+struct magic
+{ // a / B = a * m >> (N + l), 0 <= a < 2^N, B <= 2^l (Granlund, Montgomery)
+  using U = decltype(B);
+#if defined(__SIZEOF_INT128__)
+  using V = std::conditional_t<
+      std::is_void_v<double_t<U>>,
+      unsigned __int128,
+      double_t<U>
+    >;
+#else
+  using V = double_t<U>;
+#endif // __SIZEOF_INT128__
+
+  static constexpr std::size_t N{ar::bit_size_v<U> - 1};
+
+  static constexpr std::size_t l{
+    []() noexcept
+    {
+      std::size_t l{};
+
+      for (V p(1); p < V(B); p *= V(2)) ++l;
+
+      return l;
+    }()
+  };
+
+  static constexpr V m{
+    []() noexcept
+    { // ceil(2^(N + l) / B), m < 2^(N + 1)
+      V q{}, r{};
+
+      for (auto i(N + l); i; --i)
+      {
+        q *= V(2); r = V(2) * r + V(1);
+
+        if (r >= V(B)) r -= V(B), ++q;
+      }
+
+      return q + V(1);
+    }()
+  };
+
+  static constexpr U div(U const a) noexcept
+  {
+    if constexpr(std::is_same_v<V, double_t<U>>)
+    {
+      return U(V(a) * m >> (N + l));
+    }
+    else
+    { // the high half of the 256-bit product, from 64-bit halves
+      using W = std::uint64_t;
+
+      constexpr V m0{W(m)}, m1{m >> 64};
+      V const a0{W(a)}, a1{V(a) >> 64};
+
+      auto const t(a1 * m0 + (a0 * m0 >> 64));
+      auto const w(a0 * m1 + W(t));
+
+      return U((a1 * m1 + (t >> 64) + (w >> 64)) >> (l - 1));
+    }
+  }
+};
+
+}
+
 //
-template <auto B, typename T, typename E>
-constexpr dpp<T, E> div(dpp<T, E> const& a) noexcept
+template <auto B, typename T, typename E, rounding R>
+  requires(detail::integral<decltype(B)> && bool(B))
+constexpr dpp<T, E, R> div(dpp<T, E, R> const& a) noexcept
+{ // same as a / B, but without a runtime division
+  using D = dpp<T, E, R>;
+  using U = typename D::sig2_t;
+  using F = typename D::exp2_t;
+
+  using namespace detail;
+
+  constexpr auto b(ar::coeff<D(B)>());
+  constexpr auto neg(intt::is_neg(b.m_));
+  constexpr auto c(ar::coeff<neg ? U(-U(b.m_)) : U(b.m_)>());
+
+  static_assert(!isnan(b));
+
+  if (isnan(a)) [[unlikely]] return nan;
+  else if (!a.m_) [[unlikely]] return {};
+
+  constexpr F e0(ar::coeff<maxpow10e<T, F>()>());
+
+  F e(F(a.e_) - F(b.e_) - e0);
+  U m(ar::coeff<pow(U(10), e0)>() * U(a.m_));
+
+  widen<T>(m, e);
+
+  // rounded like the quotient in operator/
+  if (auto const n(intt::is_neg(m)); U(1) == c)
+    return D(neg ? U(-m) : m, e);
+  else
+  {
+    auto const u(n ? U(-m) : m);
+    auto q(magic<c>::div(u));
+
+    if constexpr(rounding::toward_zero != R)
+    { // a guard digit and a sticky digit, truncation needs neither
+      auto r(u - q * c);
+
+      for (; q <= ar::coeff<U(10 * U(D::mmax))>(); --e)
+      {
+        auto const t(magic<c>::div(U(10) * r)); // 10 * r < 10 * c fits
+
+        q = U(10) * q + t;
+        r = U(10) * r - t * c;
+      }
+
+      if (r) jam<R>(q, e);
+    }
+
+    return D(n == neg ? q : U(-q), e);
+  }
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> div2(dpp<T, E, R> const& a) noexcept
 {
-  return a * ar::coeff<inv(dpp<T, E>(B))>();
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  return isnan(a) ? nan : dpp<T, E, R>(U(5) * U(a.m_), F(a.e_) - F(1));
 }
 
-template <typename T, typename E>
-constexpr dpp<T, E> div2(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> div4(dpp<T, E, R> const& a) noexcept
 {
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
-  return isnan(a) ? nan : dpp<T, E>(U(5) * U(a.m_), F(a.e_) - F(1));
+  return isnan(a) ? nan : dpp<T, E, R>(U(25) * U(a.m_), F(a.e_) - F(2));
 }
 
-template <typename T, typename E>
-constexpr dpp<T, E> div4(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> div5(dpp<T, E, R> const& a) noexcept
 {
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
-  return isnan(a) ? nan : dpp<T, E>(U(25) * U(a.m_), F(a.e_) - F(2));
+  return isnan(a) ? nan : dpp<T, E, R>(U(a.m_) << 1, F(a.e_) - F(1));
 }
 
-template <typename T, typename E>
-constexpr dpp<T, E> div5(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> div8(dpp<T, E, R> const& a) noexcept
 {
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
-  return isnan(a) ? nan : dpp<T, E>(U(a.m_) << 1, F(a.e_) - F(1));
+  return isnan(a) ? nan : dpp<T, E, R>(U(125) * U(a.m_), F(a.e_) - F(3));
 }
 
-template <typename T, typename E>
-constexpr dpp<T, E> div8(dpp<T, E> const& a) noexcept
+template <int E10 = 1, typename T, typename E, rounding R>
+constexpr dpp<T, E, R> div10(dpp<T, E, R> const& a) noexcept
 {
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
 
-  return isnan(a) ? nan : dpp<T, E>(U(125) * U(a.m_), F(a.e_) - F(3));
+  return isnan(a) ? nan : dpp<T, E, R>(a.m_, F(a.e_) - F(E10));
 }
 
-template <int E10 = 1, typename T, typename E>
-constexpr dpp<T, E> div10(dpp<T, E> const& a) noexcept
+template <int E2 = 1, typename T, typename E, rounding R>
+constexpr dpp<T, E, R> mul2(dpp<T, E, R> const& a) noexcept
 {
-  using F = typename dpp<T, E>::exp2_t;
+  using U = typename dpp<T, E, R>::sig2_t;
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  return isnan(a) ? nan : dpp<T, E, R>(U(a.m_) << E2, F(a.e_));
+}
+
+//
+template <typename T, typename E, rounding R>
+constexpr int ndigits(dpp<T, E, R> const& a) noexcept
+{ // decimal digits in the significand, 0 for 0 and nan
+  constexpr auto p10{
+    []() noexcept
+    {
+      std::array<T, detail::maxpow10e<T>() + 1> p{T(1)};
+
+      for (std::size_t i(1); p.size() != i; ++i) p[i] = T(10) * p[i - 1];
+
+      return p;
+    }()
+  };
 
-  return isnan(a) ? nan : dpp<T, E>(a.m_, F(a.e_) - F(E10));
+  return isnan(a) ? 0 : int(std::upper_bound(p10.begin(), p10.end(),
+    intt::is_neg(a.m_) ? T(-a.m_) : a.m_) - p10.begin());
 }
 
-template <int E2 = 1, typename T, typename E>
-constexpr dpp<T, E> mul2(dpp<T, E> const& a) noexcept
+template <typename T, typename E, rounding R>
+constexpr auto ilogb10(dpp<T, E, R> const& a) noexcept
+{ // exponent of the leading digit, min_v<exp2_t> for 0 and nan
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  return isnan(a) || !a.m_ ? detail::min_v<F> :
+    F(F(a.e_) + F(ndigits(a) - 1));
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> scalb10(dpp<T, E, R> const& a,
+  std::integral auto const n) noexcept
+{ // a * 10^n, the exponent is adjusted directly
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  // beyond these limits the result is certainly nan or 0
+  constexpr auto l(ar::coeff<F(dpp<T, E, R>::emax) - F(dpp<T, E, R>::emin) +
+    F(detail::maxpow10e<T>() + 1)>());
+
+  if (isnan(a) || !a.m_) [[unlikely]] return a;
+  else if (std::cmp_greater(n, l)) [[unlikely]] return nan;
+  else if (std::cmp_less(n, -l)) [[unlikely]] return {};
+
+  return {a.m_, F(F(a.e_) + F(n))};
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> ldexp10(dpp<T, E, R> const& a,
+  std::integral auto const n) noexcept
 {
-  using U = typename dpp<T, E>::sig2_t;
-  using F = typename dpp<T, E>::exp2_t;
+  return scalb10(a, n);
+}
+
+template <typename T, typename E, rounding R>
+constexpr dpp<T, E, R> frexp10(dpp<T, E, R> const& a,
+  std::integral auto* const n) noexcept
+{ // a = f * 10^n, 0.1 <= |f| < 1
+  using F = typename dpp<T, E, R>::exp2_t;
+
+  if (isnan(a) || !a.m_) [[unlikely]] { *n = {}; return a; }
+
+  auto const d(ndigits(a));
+
+  *n = F(a.e_) + F(d);
 
-  return isnan(a) ? nan : dpp<T, E>(U(a.m_) << E2, F(a.e_));
+  return {direct, a.m_, E(-d)};
 }
 
 }